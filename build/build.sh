@@ -1,5 +1,5 @@
 # compile all sources and produce an object file named "app"
-gcc ../src/*.c -o ../obj/app
+gcc ../src/*.c -o ../obj/app -pthread
 
 # an object file that can be linked
-../obj/app
\ No newline at end of file
+../obj/app
@@ -0,0 +1,258 @@
+/**
+ * @brief This bp_tree.h file contains the data structures and functions of an ordered map
+ * from 64-bit integer keys to values, implemented as a B+ tree. The struct that represents
+ * the map is named "bp_tree" and its nodes "bp_node".
+ * Unlike the general tree, whose positions each hold one element, a node of a B+ tree holds
+ * up to BP_MAX_KEYS sorted keys in one array that spans a few cache lines, so that a lookup
+ * touches one node per level of a tree only a handful of levels high, and searches each
+ * node's keys with a branchless binary search instead of following a pointer per key.
+ * Values are only stored in the leaves, which are linked in key order, so a range scan
+ * walks along the leaves without climbing the tree.
+ *
+ * Lookups, insertions and removals run in O(log n) time; visiting k consecutive keys costs
+ * O(log n + k).
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_BP_TREE_H
+#define _DSA_BP_TREE_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief The length of the key array of a node. 32 keys of 8 bytes fill four 64-byte cache
+ * lines; one entry is kept free so that a node can overflow by one key before it is split.
+ */
+#ifndef BP_NODE_KEYS
+#define BP_NODE_KEYS 32
+#endif
+
+/// @brief The largest number of keys a node holds between operations.
+#define BP_MAX_KEYS (BP_NODE_KEYS - 1)
+
+/// @brief The smallest number of keys a node other than the root holds.
+#define BP_MIN_KEYS (BP_MAX_KEYS / 2)
+
+/// @brief The alignment of the nodes, the size of a cache line.
+#define BP_NODE_ALIGN 64
+
+
+////////////////////// NODE STRUCTURE //////////////////////
+
+/**
+ * @brief A node of a B+ tree. An internal node with n keys has n + 1 children, and every key
+ * in its child i + 1 is at least keys[i] and less than keys[i + 1]. A leaf stores the value
+ * of each of its keys.
+ */
+typedef struct bp_node{
+
+    /// @brief The number of keys in the node.
+    uint32_t num_keys;
+
+    /// @brief True if the node is a leaf.
+    bool is_leaf;
+
+    /// @brief The sorted keys.
+    int64_t keys[BP_NODE_KEYS];
+
+    union{
+
+        /// @brief The children of an internal node.
+        struct bp_node* children[BP_NODE_KEYS + 1];
+
+        /// @brief The values of the keys of a leaf.
+        void* values[BP_NODE_KEYS];
+    };
+
+    /// @brief The next leaf in key order, or null; unused in internal nodes.
+    struct bp_node* next;
+
+} bp_node;
+
+////////////////////// END OF NODE STRUCTURE //////////////////////
+
+
+////////////////////// B+ TREE STRUCTURE //////////////////////
+
+/**
+ * @brief An ordered map implemented as a B+ tree.
+ */
+typedef struct bp_tree{
+
+    /// @brief The root node, a leaf while the tree fits in one node.
+    bp_node* root;
+
+    /// @brief The leaf with the smallest keys.
+    bp_node* first_leaf;
+
+    /// @brief The number of keys in the tree.
+    size_t size;
+
+    /// @brief The number of levels of nodes, 1 for a tree that is a single leaf.
+    uint32_t height;
+
+} bp_tree;
+
+/**
+ * @brief A position in the sequence of keys of a B+ tree, used to scan keys in order.
+ * @note The tree must not be modified while an iterator is in use.
+ */
+typedef struct bp_iter{
+
+    /// @brief The leaf of the current key, or null past the last key.
+    bp_node* leaf;
+
+    /// @brief The index of the current key in the leaf.
+    uint32_t index;
+
+} bp_iter;
+
+/**
+ * @brief A pointer to a function that visits a key and its value.
+ * @param key The key.
+ * @param value The value of the key.
+ * @param ctx A pointer to caller supplied state, passed through unchanged.
+ */
+typedef void (*bp_visit)(int64_t key, void* value, void* ctx);
+
+////////////////////// END OF B+ TREE STRUCTURE //////////////////////
+
+
+////////////////////// B+ TREE FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates an empty B+ tree.
+ * @return a pointer to the tree, or null if memory could not be allocated.
+ */
+bp_tree* init_bp_tree();
+
+/**
+ * @brief Deallocates a B+ tree and all its nodes. The values are not deallocated.
+ * @param tree A B+ tree.
+ * @return null.
+ */
+bp_tree* destroy_bp_tree(bp_tree* tree);
+
+/**
+ * @brief Returns the number of keys in the tree.
+ * @param tree A B+ tree.
+ * @return the number of keys.
+ */
+size_t bp_size(bp_tree* tree);
+
+/**
+ * @brief Returns the value of a key.
+ * @param tree A B+ tree.
+ * @param key The key to look for.
+ * @return the value, or null if the tree does not have the key.
+ */
+void* bp_get(bp_tree* tree, int64_t key);
+
+/**
+ * @brief Checks if the tree has a key.
+ * @param tree A B+ tree.
+ * @param key The key to look for.
+ * @return true if the tree has the key.
+ */
+bool bp_contains(bp_tree* tree, int64_t key);
+
+/**
+ * @brief Sets the value of a key, adding the key if the tree does not have it.
+ * @param tree A B+ tree.
+ * @param key The key.
+ * @param value The value, not null.
+ * @param old_value Receives the former value of the key, or null if the key was added; may
+ * be null.
+ * @return true if the value was set, false if memory could not be allocated, in which case
+ * the tree is unchanged.
+ */
+bool bp_put(bp_tree* tree, int64_t key, void* value, void** old_value);
+
+/**
+ * @brief Removes a key from the tree.
+ * @param tree A B+ tree.
+ * @param key The key to be removed.
+ * @return the value of the key, or null if the tree does not have the key.
+ */
+void* bp_remove(bp_tree* tree, int64_t key);
+
+/**
+ * @brief Builds the tree from keys that are sorted in increasing order, bottom up in O(n)
+ * time, with every node nearly full. This is much faster than n insertions and leaves the
+ * leaves contiguous in key order.
+ * @param tree An empty B+ tree.
+ * @param keys An array of n keys, strictly increasing.
+ * @param values An array of the n values of the keys, none of them null.
+ * @param n The number of keys.
+ * @return true if the tree was built, false if it was not empty, the keys were not strictly
+ * increasing or memory could not be allocated; the tree is then unchanged.
+ */
+bool bp_bulk_load(bp_tree* tree, const int64_t* keys, void* const* values, size_t n);
+
+/**
+ * @brief Returns an iterator at the smallest key that is not less than a key.
+ * @param tree A B+ tree.
+ * @param key The key to compare with; INT64_MIN starts at the smallest key.
+ * @return the iterator, which is not valid if every key is less than the given one.
+ */
+bp_iter bp_seek(bp_tree* tree, int64_t key);
+
+/**
+ * @brief Checks if an iterator refers to a key.
+ * @param iter A pointer to an iterator.
+ * @return true if the iterator has not run past the last key.
+ */
+static inline bool bp_iter_valid(bp_iter* iter){
+    return iter->leaf != NULL;
+}
+
+/**
+ * @brief Returns the key an iterator refers to.
+ * @param iter A pointer to a valid iterator.
+ * @return the key.
+ */
+static inline int64_t bp_iter_key(bp_iter* iter){
+    return iter->leaf->keys[iter->index];
+}
+
+/**
+ * @brief Returns the value of the key an iterator refers to.
+ * @param iter A pointer to a valid iterator.
+ * @return the value.
+ */
+static inline void* bp_iter_value(bp_iter* iter){
+    return iter->leaf->values[iter->index];
+}
+
+/**
+ * @brief Moves an iterator to the next key in order.
+ * @param iter A pointer to a valid iterator.
+ */
+static inline void bp_iter_next(bp_iter* iter){
+
+    if(++(iter->index) == iter->leaf->num_keys){
+        iter->leaf = iter->leaf->next;
+        iter->index = 0;
+    }
+}
+
+/**
+ * @brief Visits, in order, the keys not less than "low" and less than "high".
+ * @param tree A B+ tree.
+ * @param low The lower bound.
+ * @param high The upper bound.
+ * @param func A pointer to the function that visits each key and its value.
+ * @param ctx A pointer that is passed on to "func".
+ * @return the number of keys visited.
+ */
+size_t bp_for_range(bp_tree* tree, int64_t low, int64_t high, bp_visit func, void* ctx);
+
+////////////////////// END OF B+ TREE FUNCTIONS //////////////////////
+
+#endif
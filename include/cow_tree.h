@@ -0,0 +1,191 @@
+/**
+ * @brief This cow_tree.h file contains the structures and interfaces for a persistent,
+ * copy-on-write general tree that provides consistent snapshots of a tree while it is being
+ * modified. The positions of the tree, named "ct_node", are shared between the current
+ * version of the tree and every snapshot taken of it, and are reference counted. A
+ * modification copies only the positions on the path from the root to the position being
+ * changed that are shared with a snapshot ("path copying"); positions that only the current
+ * version refers to are modified in place. Taking a snapshot runs in O(1) time and a
+ * modification in O(depth * fan-out) time in the worst case.
+ *
+ * Snapshots are immutable, so any number of threads can read them without locks while
+ * the writer keeps modifying the tree. When a snapshot is released, the positions that no
+ * other version refers to are reclaimed.
+ *
+ * Positions are addressed by their path from the root: an array of child indices, where
+ * the i-th index selects a child of the position at depth i.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_COW_TREE_H
+#define _DSA_COW_TREE_H
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "general_tree.h"
+
+
+/**
+ * @brief A position of a copy-on-write tree. A position that is reachable from a snapshot is
+ * never modified.
+ */
+typedef struct ct_node{
+
+    /// @brief A pointer to the data that is stored in this position.
+    void* data_ptr;
+
+    /// @brief An array of pointers to the children of this position.
+    struct ct_node** children;
+
+    /// @brief The number of children of this position.
+    unsigned int num_children;
+
+    /// @brief The number of children the array of children has room for.
+    unsigned int num_children_cap;
+
+    /// @brief The number of versions and parent positions that refer to this position.
+    atomic_uint refcount;
+
+} ct_node;
+
+/**
+ * @brief The current, modifiable version of a copy-on-write tree, owned by a single writer.
+ */
+typedef struct cow_tree{
+
+    /// @brief The root position of the current version, or null if the tree is empty.
+    ct_node* root;
+
+    /// @brief The number of elements stored in the current version.
+    unsigned int size;
+
+} cow_tree;
+
+/**
+ * @brief An immutable version of a copy-on-write tree.
+ */
+typedef struct ct_snapshot{
+
+    /// @brief The root position of the version, or null if it is empty.
+    ct_node* root;
+
+    /// @brief The number of elements stored in the version.
+    unsigned int size;
+
+} ct_snapshot;
+
+
+//////////////////////////////// WRITER FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief Creates and initializes an empty copy-on-write tree.
+ * @return a pointer to the newly created tree, or null if allocation failed.
+ */
+cow_tree* init_cow_tree();
+
+/**
+ * @brief Creates a copy-on-write tree with the same structure and data as a general tree.
+ * @param tree A general tree.
+ * @return a pointer to the newly created tree, or null if allocation failed.
+ */
+cow_tree* ct_from_gt(g_tree* tree);
+
+/**
+ * @brief Releases the current version of the tree. Positions that are still part of a
+ * snapshot are reclaimed when the last such snapshot is released.
+ * @param tree A copy-on-write tree.
+ * @return a null value indicating that the tree is successfully deleted.
+ */
+cow_tree* destroy_cow_tree(cow_tree* tree);
+
+/**
+ * @brief Creates the root position of an empty tree.
+ * @param tree A copy-on-write tree.
+ * @param data A pointer to the data to be stored in the root.
+ * @return true if the root was added, false if the tree already has a root.
+ */
+bool ct_add_root(cow_tree* tree, void* data);
+
+/**
+ * @brief Adds a new last child to the position at the end of the path.
+ * @param tree A copy-on-write tree.
+ * @param path The child indices leading from the root to the parent position.
+ * @param depth The number of indices in the path, 0 for the root.
+ * @param data A pointer to the data to be stored in the new position.
+ * @return the index of the new child, or -1 if the path does not exist.
+ */
+long ct_add_child(cow_tree* tree, const unsigned int* path, unsigned int depth, void* data);
+
+/**
+ * @brief Replaces the data stored in the position at the end of the path.
+ * @param tree A copy-on-write tree.
+ * @param path The child indices leading from the root to the position.
+ * @param depth The number of indices in the path, 0 for the root.
+ * @param data A pointer to the new data.
+ * @return the data formerly stored in the position, or null if the path does not exist.
+ */
+void* ct_set(cow_tree* tree, const unsigned int* path, unsigned int depth, void* data);
+
+/**
+ * @brief Removes the position at the end of the path, together with all its descendants,
+ * from the current version. The children after it move one index down.
+ * @param tree A copy-on-write tree.
+ * @param path The child indices leading from the root to the position.
+ * @param depth The number of indices in the path, 0 to remove the root.
+ * @return true if the position was removed.
+ */
+bool ct_remove(cow_tree* tree, const unsigned int* path, unsigned int depth);
+
+/**
+ * @brief Takes an O(1) snapshot of the current version. It must be called by the writer, or
+ * synchronized with it, but the snapshot can then be handed to any thread.
+ * @param tree A copy-on-write tree.
+ * @return the snapshot, or null if allocation failed.
+ */
+ct_snapshot* ct_take_snapshot(cow_tree* tree);
+
+//////////////////////////////// END OF WRITER FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// READER FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief Releases a snapshot, reclaiming the positions no other version refers to. Any
+ * thread may release a snapshot without locking.
+ * @param snap A snapshot.
+ * @return a null value indicating that the snapshot is successfully released.
+ */
+ct_snapshot* ct_release_snapshot(ct_snapshot* snap);
+
+/**
+ * @brief Returns the position at the end of a path in a snapshot.
+ * @param snap A snapshot.
+ * @param path The child indices leading from the root to the position.
+ * @param depth The number of indices in the path, 0 for the root.
+ * @return the position, or null if the path does not exist.
+ */
+ct_node* ct_resolve(ct_snapshot* snap, const unsigned int* path, unsigned int depth);
+
+/**
+ * @brief Returns the i-th child of a position, or null if it has fewer children.
+ */
+ct_node* ct_child(ct_node* node, unsigned int i);
+
+/**
+ * @brief Returns the number of children of a position.
+ */
+unsigned int ct_num_children(ct_node* node);
+
+/**
+ * @brief Returns a pointer to the data stored in a position.
+ */
+void* ct_element(ct_node* node);
+
+//////////////////////////////// END OF READER FUNCTIONS ////////////////////////////////
+
+#endif // _DSA_COW_TREE_H
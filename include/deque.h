@@ -0,0 +1,290 @@
+/**
+ * @brief This deque.h file contains the data structures and functions that implement the
+ * Deque ADT with a circular array (ring buffer), together with Queue and Stack adapters on
+ * top of it. The struct that represents the deque is named "rb_deque", which stands for
+ * "Ring Buffer Deque". Its interface mirrors the ends of the positional list ("add_first",
+ * "add_last", "first", "last"), but elements are stored in one contiguous array instead of
+ * one allocated position each, so workloads that only touch the ends of a sequence do not
+ * pay a malloc and free per element.
+ * The array doubles when it is full, so insertions run in amortized O(1) time and all the
+ * other single element operations in O(1). The batch operations copy whole runs of elements
+ * with at most two memcpy calls.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_DEQUE_H
+#define _DSA_DEQUE_H
+
+#include <stdlib.h>
+#include "positional_list.h"
+
+/// @brief The number of elements a deque has room for when it is created, a power of two.
+#define DQ_DEFAULT_CAPACITY 16
+
+
+////////////////////// DEQUE STRUCTURE //////////////////////
+
+/**
+ * @brief A generic deque implemented with a circular array of element pointers.
+ */
+typedef struct rb_deque{
+
+    /// @brief The circular array of pointers to the elements.
+    void** data;
+
+    /// @brief The number of slots of the array, always a power of two.
+    uint capacity;
+
+    /// @brief The index of the first element in the array.
+    uint front;
+
+    /// @brief The number of elements in the deque.
+    uint num_elements;
+
+} rb_deque;
+
+/**
+ * @brief A first-in first-out queue adapter over a ring buffer deque.
+ */
+typedef struct a_queue{
+
+    /// @brief The deque storing the elements, front of the queue first.
+    rb_deque* dq;
+
+} a_queue;
+
+/**
+ * @brief A last-in first-out stack adapter over a ring buffer deque.
+ */
+typedef struct a_stack{
+
+    /// @brief The deque storing the elements, top of the stack last.
+    rb_deque* dq;
+
+} a_stack;
+
+////////////////////// END OF DEQUE STRUCTURE //////////////////////
+
+
+////////////////////// DEQUE FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates and initializes a deque.
+ * @return the address of the newly created deque, or null if allocation failed.
+ */
+rb_deque* init_deque();
+
+/**
+ * @brief Deallocates the memory that was allocated to the deque. The elements are not
+ * deallocated.
+ * @param dq A deque.
+ * @return a null value indicating that the deque is successfully deleted.
+ */
+rb_deque* destroy_deque(rb_deque* dq);
+
+/**
+ * @brief Returns true if the deque does not contain any elements.
+ * @param dq A deque.
+ * @return true if the deque is empty, otherwise false.
+ */
+BOOL dq_is_empty(rb_deque* dq);
+
+/**
+ * @brief Returns the number of elements in the deque.
+ * @param dq A deque.
+ * @return the number of elements in the deque.
+ */
+uint dq_size(rb_deque* dq);
+
+/**
+ * @brief Inserts a new element at the front of the deque.
+ * @param elem_ptr A pointer to the element to be inserted.
+ * @param dq A deque.
+ * @return true if the element was inserted, false if memory could not be allocated.
+ */
+BOOL dq_add_first(void* elem_ptr, rb_deque* dq);
+
+/**
+ * @brief Inserts a new element at the back of the deque.
+ * @param elem_ptr A pointer to the element to be inserted.
+ * @param dq A deque.
+ * @return true if the element was inserted, false if memory could not be allocated.
+ */
+BOOL dq_add_last(void* elem_ptr, rb_deque* dq);
+
+/**
+ * @brief Returns the first element of the deque without removing it.
+ * @param dq A deque.
+ * @return the first element, or null if the deque is empty.
+ */
+void* dq_first(rb_deque* dq);
+
+/**
+ * @brief Returns the last element of the deque without removing it.
+ * @param dq A deque.
+ * @return the last element, or null if the deque is empty.
+ */
+void* dq_last(rb_deque* dq);
+
+/**
+ * @brief Returns the element at index i, counted from the front of the deque.
+ * @param i The index of the element.
+ * @param dq A deque.
+ * @return the element at index i, or null if i is out of range.
+ */
+void* dq_get(uint i, rb_deque* dq);
+
+/**
+ * @brief Removes and returns the first element of the deque.
+ * @param dq A deque.
+ * @return the removed element, or null if the deque is empty.
+ */
+void* dq_delete_first(rb_deque* dq);
+
+/**
+ * @brief Removes and returns the last element of the deque.
+ * @param dq A deque.
+ * @return the removed element, or null if the deque is empty.
+ */
+void* dq_delete_last(rb_deque* dq);
+
+/**
+ * @brief Inserts n elements at the back of the deque, in array order, growing the array at
+ * most once.
+ * @param elems An array of pointers to the elements to be inserted.
+ * @param n The number of elements.
+ * @param dq A deque.
+ * @return true if the elements were inserted, false if memory could not be allocated, in
+ * which case none were.
+ */
+BOOL dq_add_last_n(void** elems, uint n, rb_deque* dq);
+
+/**
+ * @brief Removes up to n elements from the front of the deque, storing them in order.
+ * @param out An array with room for n element pointers.
+ * @param n The maximum number of elements to remove.
+ * @param dq A deque.
+ * @return the number of elements removed.
+ */
+uint dq_delete_first_n(void** out, uint n, rb_deque* dq);
+
+/**
+ * @brief Removes up to n elements from the back of the deque, storing them last element first.
+ * @param out An array with room for n element pointers.
+ * @param n The maximum number of elements to remove.
+ * @param dq A deque.
+ * @return the number of elements removed.
+ */
+uint dq_delete_last_n(void** out, uint n, rb_deque* dq);
+
+////////////////////// END OF DEQUE FUNCTIONS //////////////////////
+
+
+////////////////////// QUEUE FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates and initializes a queue.
+ * @return the address of the newly created queue, or null if allocation failed.
+ */
+a_queue* init_queue();
+
+/**
+ * @brief Deallocates the memory that was allocated to the queue. The elements are not
+ * deallocated.
+ * @param q A queue.
+ * @return a null value indicating that the queue is successfully deleted.
+ */
+a_queue* destroy_queue(a_queue* q);
+
+/**
+ * @brief Adds an element to the back of the queue.
+ * @return true if the element was added.
+ */
+BOOL enqueue(void* elem_ptr, a_queue* q);
+
+/**
+ * @brief Removes and returns the element at the front of the queue, or null if it is empty.
+ */
+void* dequeue(a_queue* q);
+
+/**
+ * @brief Returns the element at the front of the queue, or null if it is empty.
+ */
+void* queue_first(a_queue* q);
+
+/**
+ * @brief Adds n elements to the back of the queue, in array order.
+ * @return true if the elements were added.
+ */
+BOOL enqueue_n(void** elems, uint n, a_queue* q);
+
+/**
+ * @brief Removes up to n elements from the front of the queue, in queue order.
+ * @return the number of elements removed.
+ */
+uint dequeue_n(void** out, uint n, a_queue* q);
+
+/**
+ * @brief Returns the number of elements in the queue.
+ */
+uint queue_size(a_queue* q);
+
+////////////////////// END OF QUEUE FUNCTIONS //////////////////////
+
+
+////////////////////// STACK FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates and initializes a stack.
+ * @return the address of the newly created stack, or null if allocation failed.
+ */
+a_stack* init_stack();
+
+/**
+ * @brief Deallocates the memory that was allocated to the stack. The elements are not
+ * deallocated.
+ * @param s A stack.
+ * @return a null value indicating that the stack is successfully deleted.
+ */
+a_stack* destroy_stack(a_stack* s);
+
+/**
+ * @brief Pushes an element onto the top of the stack.
+ * @return true if the element was pushed.
+ */
+BOOL push(void* elem_ptr, a_stack* s);
+
+/**
+ * @brief Removes and returns the element at the top of the stack, or null if it is empty.
+ */
+void* pop(a_stack* s);
+
+/**
+ * @brief Returns the element at the top of the stack, or null if it is empty.
+ */
+void* top(a_stack* s);
+
+/**
+ * @brief Pushes n elements onto the stack, in array order, so the last one ends on top.
+ * @return true if the elements were pushed.
+ */
+BOOL push_n(void** elems, uint n, a_stack* s);
+
+/**
+ * @brief Pops up to n elements from the stack, the top element first.
+ * @return the number of elements popped.
+ */
+uint pop_n(void** out, uint n, a_stack* s);
+
+/**
+ * @brief Returns the number of elements in the stack.
+ */
+uint stack_size(a_stack* s);
+
+////////////////////// END OF STACK FUNCTIONS //////////////////////
+
+#endif // _DSA_DEQUE_H
@@ -0,0 +1,34 @@
+/**
+ * @brief This fnv_hash.h file contains the 64-bit FNV-1a hash, which the string keys of the
+ * general tree, the LRU cache and the string pool are hashed with, and which checksums the
+ * journal of the mapped list. Keeping a single copy means a string hashes to the same code in
+ * all of them, so a pooled string can be looked up in a tree or cache without rehashing.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_FNV_HASH_H
+#define _DSA_FNV_HASH_H
+
+#include <stdlib.h>
+#include <stdint.h>
+
+/// @brief The state a hash starts from.
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+
+/// @brief The prime each byte is multiplied in with.
+#define FNV_PRIME 0x100000001b3ULL
+
+/**
+ * @brief Folds bytes into a 64-bit FNV-1a hash.
+ * @param h The hash of the bytes before these, or FNV_OFFSET_BASIS to start a new hash.
+ * @param bytes A pointer to the bytes.
+ * @param length The number of bytes.
+ * @return the hash of all the bytes so far.
+ */
+uint64_t fnv_hash(uint64_t h, const void* bytes, size_t length);
+
+#endif // _DSA_FNV_HASH_H
@@ -19,9 +19,73 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include "handle_table.h"
 
 #define DEFAULT_NUM_CHILDREN 5
 
+/// @brief Flag of a position that lives in a block of positions owned by its tree.
+#define GT_POS_IN_ARENA 0x1u
+
+/// @brief Flag of a position whose array of children lives in a block owned by its tree.
+#define GT_CHILDREN_IN_ARENA 0x2u
+
+/// @brief The number of paths whose lookups "gt_resolve_paths" interleaves.
+#define GT_RESOLVE_GROUP 8
+
+
+/**
+ * @brief Stores a reference to a function that computes the hash code of the key stored in
+ * a position, used to look up children by key.
+ * @param data A pointer to the data stored in a position, or to a key being looked up.
+ * @return the hash code of the key.
+ */
+typedef size_t (*gt_key_hash)(void* data);
+
+/**
+ * @brief Stores a reference to a function that checks if the keys stored in two positions,
+ * or a key being looked up and the key of a position, are equal.
+ * @return true if the keys are equal, otherwise false.
+ */
+typedef bool (*gt_key_equals)(void* data_a, void* data_b);
+
+/**
+ * @brief A slot of a child index, either empty, holding a removed child marker, or holding
+ * a child together with the hash code of its key.
+ */
+typedef struct gt_index_slot{
+
+    /// @brief The hash code of the child's key.
+    size_t hash;
+
+    /// @brief A pointer to the child, or null if the slot is empty.
+    struct gt_pos* child;
+
+} gt_index_slot;
+
+/**
+ * @brief An open addressing hash index from keys to the children of one position.
+ */
+typedef struct gt_child_index{
+
+    /// @brief The slots of the index.
+    gt_index_slot* slots;
+
+    /// @brief The number of slots, always a power of two.
+    unsigned int cap;
+
+    /// @brief The number of children in the index.
+    unsigned int count;
+
+    /// @brief The number of slots that hold a removed child marker.
+    unsigned int num_removed;
+
+    /// @brief A pointer to the function that hashes keys.
+    gt_key_hash hash;
+
+    /// @brief A pointer to the function that compares keys.
+    gt_key_equals equals;
+
+} gt_child_index;
 
 /**
  * @brief A position of a general tree, that can have many children and only
@@ -38,6 +102,12 @@ typedef struct gt_pos{
     /// @brief An array of pointers to general tree positions that are children of this position.
     struct gt_pos** children;
 
+    /**
+     * @brief An index that finds a child by its key without scanning "children", or null.
+     * It is only created for positions with more children than the tree's index threshold.
+     */
+    struct gt_child_index* index;
+
     /// @brief The number of children of this position.
     unsigned int num_children;
 
@@ -50,9 +120,96 @@ typedef struct gt_pos{
     /// @brief Stores the next available slot to store a pointer to a child of this position.
     unsigned int next_slot;
 
+    /// @brief The index of this position in its parent's array of children.
+    unsigned int index_in_parent;
+
+    /// @brief The handle of this position if the tree has handles enabled, otherwise H_NULL.
+    h_handle handle;
+
+    /**
+     * @brief A combination of GT_POS_IN_ARENA and GT_CHILDREN_IN_ARENA, marking memory that
+     * must not be freed individually because it belongs to one of the tree's blocks.
+     */
+    unsigned int flags;
+
+    /**
+     * @brief The cached Merkle hash of the subtree rooted at this position, or 0 if it has
+     * not been computed since the subtree last changed.
+     * @note It makes every position 8 bytes larger, 64 bytes instead of 56, whether or not
+     * the tree is ever hashed. It is kept in the position rather than in a side table because
+     * gt_diff() reads it for every pair of children it compares.
+     */
+    size_t subtree_hash;
+
 } gt_pos;
 
 
+/**
+ * @brief Counters of the memory held by a general tree, updated by every tree function that
+ * allocates or frees positions, arrays of children or child indexes.
+ */
+typedef struct gt_mem_counters{
+
+    /// @brief The total capacity of the arrays of children of the positions in the tree.
+    size_t child_slots;
+
+    /// @brief The number of arrays of children that were allocated one by one.
+    unsigned int num_heap_arrays;
+
+    /// @brief The number of positions the tree's blocks have room for.
+    unsigned int arena_nodes;
+
+    /// @brief The number of positions in the tree's blocks that are still in use.
+    unsigned int arena_nodes_live;
+
+    /// @brief The number of children slots in the tree's blocks.
+    size_t arena_slots;
+
+    /// @brief The number of children slots in the tree's blocks that are still in use.
+    size_t arena_slots_live;
+
+    /// @brief The number of bytes held by child indexes.
+    size_t index_bytes;
+
+    /// @brief The number of child indexes.
+    unsigned int num_indexes;
+
+    /// @brief The number of times an array of children was grown.
+    unsigned long num_grows;
+
+    /// @brief The number of times an array of children was shrunk.
+    unsigned long num_shrinks;
+
+} gt_mem_counters;
+
+/**
+ * @brief How the arrays of children of a general tree's positions grow and shrink.
+ */
+typedef struct gt_growth_policy{
+
+    /// @brief The factor an array's capacity is multiplied by when it grows, more than 1.
+    float growth_factor;
+
+    /**
+     * @brief An array shrinks once its load falls below this, to the capacity its children
+     * would have just after growing, so that an array is never shrunk right back to the
+     * size it would grow from. 0 disables shrinking.
+     */
+    float shrink_load;
+
+    /// @brief The smallest capacity an array grows to or shrinks to.
+    unsigned int min_capacity;
+
+    /// @brief Whether arrays are resized in place with realloc, instead of copied into a
+    /// freshly allocated array.
+    bool use_realloc;
+
+    /// @brief Whether arrays only shrink when gt_compact_children() is called, instead of
+    /// as soon as a child is removed or moved away.
+    bool lazy_shrink;
+
+} gt_growth_policy;
+
 /**
  * @brief A general tree ADT, implemented as a linked data structure.
  */
@@ -63,6 +220,39 @@ typedef struct g_tree{
 
     /// @brief The number of elements stored in the tree.
     unsigned int size;
+
+    /**
+     * @brief The table that resolves handles to the positions of this tree, or null if
+     * "gt_enable_handles" was not called.
+     */
+    h_table* handles;
+
+    /// @brief The blocks of positions and children arrays allocated in bulk for this tree.
+    void** arenas;
+
+    /// @brief The number of blocks in "arenas".
+    unsigned int num_arenas;
+
+    /// @brief The function that hashes the keys of positions, when child indexes are enabled.
+    gt_key_hash key_hash;
+
+    /// @brief The function that compares the keys of positions, when child indexes are enabled.
+    gt_key_equals key_equals;
+
+    /**
+     * @brief Positions with more children than this get a child index, 0 if child indexes
+     * are disabled.
+     */
+    unsigned int index_threshold;
+
+    /// @brief The function that hashes the data of positions for subtree hashes, or null.
+    gt_key_hash data_hash;
+
+    /// @brief How the arrays of children grow and shrink.
+    gt_growth_policy policy;
+
+    /// @brief The memory counters reported by gt_memory_usage().
+    gt_mem_counters mem;
 } g_tree;
 
 
@@ -216,12 +406,41 @@ gt_pos* add_gt_child(void* data, gt_pos* parent, g_tree* tree);
 unsigned int get_size(g_tree* tree);
 
 /**
- * @brief Deallocates the memory that was allocated to a general tree.
+ * @brief Deallocates the memory that was allocated to a general tree, its positions and their
+ * arrays of children. The data stored in the positions is not deallocated.
  * @param tree A general tree.
  * @return NULL if the tree is successfully deleted, or the address of the tree.
  */
 g_tree* delete_gt(g_tree* tree);
 
+/**
+ * @brief Deallocates a general tree a part at a time, so that dropping a huge tree can be
+ * spread over many short calls instead of one long pause. Each call frees at most
+ * "max_nodes" positions, in post-order, and the call that frees the last position also
+ * deallocates the tree itself. The data stored in the positions is not deallocated.
+ * @param tree A general tree that is no longer used for anything else; once the first step
+ * is taken, only further steps may be applied to it.
+ * @param max_nodes The most positions to free in this call; 0 is taken as 1.
+ * @return true if the tree was deallocated completely, false if more steps are needed.
+ */
+bool gt_destroy_step(g_tree* tree, unsigned int max_nodes);
+
+/**
+ * @brief Builds a general tree from an array of parent indices in O(n) time. The children
+ * of every position are counted first, so that each position's array of children is laid
+ * out at exactly the right size, and the positions and all the arrays of children are
+ * allocated as two blocks, instead of one "add_gt_child" call per position.
+ * @param data An array of n pointers, data[i] being the data stored in position i.
+ * @param parents An array of n indices, parents[i] being the index of the parent of position
+ * i, or -1 for the root. Exactly one position must be the root and the parent indices must
+ * describe a tree.
+ * @param n The number of positions.
+ * @return the newly built general tree, or null if the arrays do not describe a tree with a
+ * single root or memory could not be allocated. The children of a position are ordered by
+ * their index.
+ */
+g_tree* gt_build_from_parents(void** data, const long* parents, unsigned int n);
+
 /**
  * @brief Returns the next available index to store the address of the next child of this
  * position.
@@ -232,7 +451,8 @@ int get_next_slot(gt_pos* pos);
 
 /**
  * @brief Checks if the array of pointers to the children of this general tree position is expandable
- * based on the load factor, which must be at least 80% or 0.8 for expansion to take place.
+ * based on the load factor, which must be at least 80% or 0.8 for expansion to take place. A
+ * position without an array of children is always expandable.
  * @param pos A general tree position.
  * @return true if the position's array of pointers to children needs expansion, otherwise false.
  */
@@ -259,6 +479,479 @@ bool set_parent(gt_pos* pos, gt_pos* parent);
  */
 void gt_pos_str_print(gt_pos* pos);
 
-//gt_pos* remove_gt_pos(gt_pos* pos,)
+//////////////////////////////// HANDLE FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief Enables handle-based positions for this tree. Every position of the tree, including
+ * the ones added later, is given a 32-bit index and generation handle that refers to it
+ * through the tree's handle table. A handle whose position was freed is detected and
+ * rejected in O(1) instead of being dereferenced.
+ * @param tree A general tree.
+ * @return true if handles are enabled.
+ */
+bool gt_enable_handles(g_tree* tree);
+
+/**
+ * @brief Returns the handle of a general tree position.
+ * @param pos A general tree position.
+ * @return the handle of the position, or H_NULL if its tree does not have handles enabled.
+ */
+h_handle gt_get_handle(gt_pos* pos);
+
+/**
+ * @brief Returns the position a handle refers to.
+ * @param handle A handle issued by this tree.
+ * @param tree A general tree with handles enabled.
+ * @return the position, or null if the handle is stale.
+ */
+gt_pos* gt_h_resolve(h_handle handle, g_tree* tree);
+
+/**
+ * @brief Creates a new general tree position that stores the data and is a child of the
+ * position the handle refers to.
+ * @param data A pointer to the data to be stored in the position.
+ * @param parent The handle of the parent position.
+ * @param tree A general tree with handles enabled.
+ * @return the handle of the new position, or H_NULL if the parent handle is stale.
+ */
+h_handle gt_h_add_child(void* data, h_handle parent, g_tree* tree);
+
+//////////////////////////////// END OF HANDLE FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// PATH LOOKUP FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief Enables child indexes for this tree, so that finding the child of a position by
+ * its key runs in O(1) expected time instead of scanning the position's children. A child
+ * index is created for every position, existing or future, once it has more than threshold
+ * children; narrower positions are scanned, which is faster for them.
+ * @param tree A general tree.
+ * @param hash A pointer to the function that hashes the keys stored in the positions.
+ * @param equals A pointer to the function that compares keys.
+ * @param threshold The number of children above which a position is indexed, at least 1.
+ * @return true if child indexes are enabled.
+ */
+bool gt_enable_path_index(g_tree* tree, gt_key_hash hash, gt_key_equals equals, unsigned int threshold);
+
+/**
+ * @brief Finds the child of a position whose key equals the given key. Uses the position's
+ * child index if it has one, otherwise scans its children, comparing with the tree's key
+ * function or, if child indexes are not enabled, by address.
+ * @param parent A general tree position.
+ * @param key A pointer to the key to look for.
+ * @param tree The general tree containing the position.
+ * @return the child with that key, or null if there is none.
+ */
+gt_pos* gt_find_child(gt_pos* parent, void* key, g_tree* tree);
+
+/**
+ * @brief Resolves a path of string keys separated by '/', such as "a/b/c", starting at the
+ * children of the root. Leading, trailing and repeated separators are ignored, so "" and "/"
+ * resolve to the root. Runs in O(depth) expected time when wide positions are indexed.
+ * Keys are compared with the tree's key function, or with gt_str_equals() if child indexes
+ * are not enabled.
+ * @param tree A general tree whose keys are strings.
+ * @param path The path to be resolved.
+ * @return the position at the end of the path, or null if a key along it is not found.
+ */
+gt_pos* gt_resolve_path(g_tree* tree, const char* path);
+
+/**
+ * @brief Resolves a batch of paths as "gt_resolve_path" does. The lookups of up to
+ * GT_RESOLVE_GROUP paths are interleaved level by level, and the index slots or children
+ * arrays each lookup is about to read are prefetched first, so that the cache misses of
+ * different paths overlap.
+ * @param tree A general tree whose keys are strings.
+ * @param paths An array of n paths.
+ * @param n The number of paths.
+ * @param out An array of n positions that receives the result for each path, null when a
+ * path does not resolve.
+ * @return the number of paths that resolved.
+ */
+unsigned int gt_resolve_paths(g_tree* tree, const char** paths, unsigned int n, gt_pos** out);
+
+/**
+ * @brief Hashes a key that is a string (char*), with 64-bit FNV-1a.
+ */
+size_t gt_str_hash(void* data);
+
+/**
+ * @brief Checks if two string (char*) keys are equal.
+ */
+bool gt_str_equals(void* data_a, void* data_b);
+
+//////////////////////////////// END OF PATH LOOKUP FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// EDITING FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief Removes a position, together with all its descendants, from the tree and frees the
+ * memory allocated to them. The data stored in the positions is not deallocated.
+ * @param pos A general tree position.
+ * @param tree The general tree containing the position.
+ * @return a null value indicating that the position was removed.
+ */
+gt_pos* remove_gt_pos(gt_pos* pos, g_tree* tree);
+
+/**
+ * @brief Creates a new general tree position that stores the data and is inserted among the
+ * children of the parent position at the given index, shifting the later children along.
+ * @param data A pointer to the data to be stored in the position.
+ * @param parent A pointer to the parent position.
+ * @param index The index the new child gets, at most the parent's number of children.
+ * @param tree A general tree.
+ * @return the newly created general tree position, or null if it could not be added.
+ */
+gt_pos* gt_insert_child_at(void* data, gt_pos* parent, unsigned int index, g_tree* tree);
+
+/**
+ * @brief Replaces the data stored in a position, keeping the parent's child index and the
+ * cached subtree hashes up to date.
+ * @param pos A general tree position.
+ * @param data A pointer to the new data.
+ * @param tree The general tree containing the position.
+ * @return the data formerly stored in the position.
+ */
+void* gt_replace(gt_pos* pos, void* data, g_tree* tree);
+
+/**
+ * @brief Moves a position, together with all its descendants, to the end of the children of
+ * another position, without copying the subtree. The position is found in its parent's
+ * array of children in O(1) time through its stored index, and the later children of the
+ * old parent are shifted back to keep their order. Child indexes and cached subtree hashes
+ * of both parents are kept up to date, and handles stay valid.
+ * @param pos A general tree position that is not the root.
+ * @param new_parent The position that becomes the parent, which must not be in the subtree
+ * of "pos".
+ * @param tree The general tree containing both positions.
+ * @return true if the subtree was moved.
+ */
+bool gt_move_subtree(gt_pos* pos, gt_pos* new_parent, g_tree* tree);
+
+//////////////////////////////// END OF EDITING FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// SUBTREE HASH FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief Sets the function that hashes the data of the positions for subtree hashes, and
+ * discards all the subtree hashes cached with a previous function.
+ * @param tree A general tree.
+ * @param hash A pointer to the function that hashes the data stored in the positions.
+ * @return true if the function was set.
+ */
+bool gt_set_data_hash(g_tree* tree, gt_key_hash hash);
+
+/**
+ * @brief Spreads the bits of a hash code, so that keys whose hash codes differ only in a few
+ * bits still land in different slots.
+ * @param h A hash code.
+ * @return the mixed hash code.
+ */
+size_t gt_mix_hash(size_t h);
+
+/**
+ * @brief Folds the hash of a child's subtree into the hash of its parent, in an order
+ * sensitive way. It is how gt_subtree_hash() combines the hashes of a position's children,
+ * exposed so that other trees can compute hashes that agree with it.
+ * @param h The hash accumulated so far.
+ * @param v The hash to fold in.
+ * @return the combined hash.
+ */
+size_t gt_combine_hash(size_t h, size_t v);
+
+/**
+ * @brief Returns the Merkle hash of the subtree rooted at a position, which combines the
+ * hash of the position's data with the subtree hashes of its children, in order. Hashes
+ * are cached on the positions and invalidated along the parent chain whenever a subtree
+ * changes, so only the changed parts are rehashed.
+ * @param pos A general tree position.
+ * @param tree A general tree with a data hash function set.
+ * @return the subtree hash, never 0, or 0 if the tree has no data hash function.
+ */
+size_t gt_subtree_hash(gt_pos* pos, g_tree* tree);
+
+/**
+ * @brief Creates a copy of a general tree with the same structure, data, cached subtree
+ * hashes and growth policy, for example to keep the last state that was sent to a replica.
+ * @param tree A general tree.
+ * @return the copy, or null if memory could not be allocated.
+ */
+g_tree* gt_clone(g_tree* tree);
+
+//////////////////////////////// END OF SUBTREE HASH FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// TRAVERSAL GENERATORS ////////////////////////////////
+
+/**
+ * @brief The orders in which a walk visits the positions of a subtree.
+ */
+typedef enum gt_walk_order{
+
+    /// @brief Every position before its children, and children in index order.
+    GT_WALK_PREORDER,
+
+    /// @brief Level by level, from left to right within a level.
+    GT_WALK_BFS
+
+} gt_walk_order;
+
+/**
+ * @brief A resumable traversal of the subtree rooted at a position, for scanning a tree in
+ * pages. A pre-order walk keeps no stack: it moves between positions through the parent
+ * links and the positions' indices in their parents. A breadth-first walk moves to the next
+ * sibling the same way, and keeps a queue of the positions whose children come after those
+ * of the current parent, so it holds one pointer per position of the frontier that has
+ * children. Either step costs O(1) amortized.
+ * @note Between pages the tree may be modified, except that the position the walk produces
+ * next, and the positions queued by a breadth-first walk, must stay in the subtree; a walk
+ * saved with gt_walk_save() detects their removal when resumed.
+ */
+typedef struct gt_walk{
+
+    /// @brief The root of the subtree being walked.
+    gt_pos* start;
+
+    /// @brief The position produced next, or null when the walk is done.
+    gt_pos* next;
+
+    /// @brief The order of the walk.
+    gt_walk_order order;
+
+    /// @brief For breadth-first walks, a ring buffer of the positions whose children are
+    /// produced after the siblings of "next", in order; null until a position is queued.
+    gt_pos** queue;
+
+    /// @brief The index of the first queued position, their number and the buffer's size.
+    unsigned int queue_head;
+    unsigned int queue_len;
+    unsigned int queue_cap;
+
+    /// @brief Set when a breadth-first walk stopped early because its queue could not grow.
+    bool failed;
+
+} gt_walk;
+
+/**
+ * @brief A saved walk, made of handles only, that the caller can store, for example in a
+ * pagination token, and resume from in O(height + queue length) time.
+ */
+typedef struct gt_walk_token{
+
+    /// @brief The handle of the root of the subtree being walked.
+    h_handle start;
+
+    /// @brief The handle of the position produced next, or H_NULL when the walk is done.
+    h_handle next;
+
+    /// @brief The order of the walk.
+    gt_walk_order order;
+
+    /// @brief For breadth-first walks, the handles of the queued positions, in order, or
+    /// null if there are none.
+    h_handle* queue;
+
+    /// @brief The number of handles in "queue".
+    unsigned int queue_len;
+
+} gt_walk_token;
+
+/**
+ * @brief Returns a walk over the subtree rooted at a position.
+ * @param start The root of the subtree to walk.
+ * @param order The order of the walk.
+ * @return the walk.
+ */
+gt_walk gt_walk_begin(gt_pos* start, gt_walk_order order);
+
+/**
+ * @brief Deallocates the queue of a walk. Every walk must be ended, whatever its order.
+ * @param walk A walk.
+ */
+void gt_walk_end(gt_walk* walk);
+
+/**
+ * @brief Produces the next position of a walk.
+ * @param walk A walk.
+ * @return the next position, or null when the walk is done or, if "failed" is set, when a
+ * breadth-first walk could not queue a position.
+ */
+gt_pos* gt_walk_next(gt_walk* walk);
+
+/**
+ * @brief Produces the next positions of a walk.
+ * @param walk A walk.
+ * @param out An array that receives up to n positions.
+ * @param n The maximum number of positions to produce.
+ * @return the number of positions produced, less than n only when the walk is done.
+ */
+unsigned int gt_walk_next_n(gt_walk* walk, gt_pos** out, unsigned int n);
+
+/**
+ * @brief Saves a walk as a token.
+ * @param walk A walk.
+ * @param token Receives the saved walk, to be released with gt_walk_token_release().
+ * @return true if the walk was saved, false if the tree does not have handles enabled or
+ * memory could not be allocated.
+ */
+bool gt_walk_save(gt_walk* walk, gt_walk_token* token);
+
+/**
+ * @brief Restores a walk saved with gt_walk_save().
+ * @param walk Receives the walk, to be ended with gt_walk_end().
+ * @param token The saved walk.
+ * @param tree The general tree the walk was saved from.
+ * @return true if the walk was restored, false if one of its positions was removed, the
+ * next position is no longer in the subtree, or memory could not be allocated.
+ */
+bool gt_walk_resume(gt_walk* walk, gt_walk_token token, g_tree* tree);
+
+/**
+ * @brief Deallocates the queue of handles of a token.
+ * @param token A token filled in by gt_walk_save().
+ */
+void gt_walk_token_release(gt_walk_token* token);
+
+//////////////////////////////// END OF TRAVERSAL GENERATORS ////////////////////////////////
+
+
+//////////////////////////////// LAYOUT FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief The orders in which gt_relayout() can place the positions of a tree in memory.
+ */
+typedef enum gt_layout{
+
+    /// @brief Level by level, so that the children of a position are adjacent and the
+    /// upper levels, which every lookup passes through, share a few cache lines.
+    GT_LAYOUT_BFS,
+
+    /// @brief van Emde Boas order: the tree is cut at half its height, the top part is laid
+    /// out first and then every bottom subtree, each recursively in the same way, so that a
+    /// root-to-leaf path touches O(log_B n) blocks of any size B.
+    GT_LAYOUT_VEB
+
+} gt_layout;
+
+/**
+ * @brief A pointer to a function that is told the new address of every position moved by
+ * gt_relayout(), so that the caller can update the position pointers it keeps.
+ * @param old_pos The former address of the position, which must not be dereferenced.
+ * @param new_pos The new address of the position.
+ * @param ctx The context pointer passed to gt_relayout().
+ */
+typedef void (*gt_remap)(gt_pos* old_pos, gt_pos* new_pos, void* ctx);
+
+/**
+ * @brief Moves all the positions of the tree into one contiguous block, in the given order,
+ * and all the arrays of children into a second block in the same order, so that read-mostly
+ * trees are traversed and searched with fewer cache misses. Structure, child indexes,
+ * cached subtree hashes and handles are preserved; the arrays of children are sized
+ * exactly and grow again on the next insertion.
+ * @param tree A general tree.
+ * @param layout The order of the positions in memory.
+ * @param func A function that is told the new address of every position, or null.
+ * @param ctx A pointer that is passed on to "func".
+ * @return true if the tree was laid out, false if memory could not be allocated, in which
+ * case the tree is unchanged.
+ * @note Every gt_pos pointer into the tree, including those held by walks, is invalidated;
+ * handles and walk tokens stay valid.
+ */
+bool gt_relayout(g_tree* tree, gt_layout layout, gt_remap func, void* ctx);
+
+//////////////////////////////// END OF LAYOUT FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// MEMORY FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief A breakdown of the memory held by a general tree, in bytes. The data the positions
+ * point to belongs to the caller and is not counted.
+ */
+typedef struct gt_mem_usage{
+
+    /// @brief The data pointers stored in the positions.
+    size_t payload_bytes;
+
+    /// @brief The rest of the positions: links, counters, handles and cached hashes.
+    size_t node_overhead_bytes;
+
+    /// @brief The arrays of children, at their full capacity.
+    size_t child_array_bytes;
+
+    /// @brief The part of "child_array_bytes" that is allocated but holds no child.
+    size_t wasted_child_bytes;
+
+    /// @brief The child indexes.
+    size_t index_bytes;
+
+    /// @brief The handle table.
+    size_t handle_bytes;
+
+    /// @brief The tree structure and its list of blocks.
+    size_t tree_bytes;
+
+    /**
+     * @brief The parts of the blocks made by gt_build_from_parents(), gt_clone() and
+     * gt_relayout() whose positions or arrays were removed or outgrown. They stay allocated
+     * until the tree is deleted or laid out again.
+     */
+    size_t dead_arena_bytes;
+
+    /// @brief The number of separate heap allocations, a measure of fragmentation.
+    unsigned int num_allocations;
+
+    /// @brief The number of times an array of children was grown.
+    unsigned long num_grows;
+
+    /// @brief The number of times an array of children was shrunk.
+    unsigned long num_shrinks;
+
+    /// @brief The sum of all the byte counts above, except "wasted_child_bytes" which is
+    /// part of "child_array_bytes".
+    size_t total_bytes;
+
+} gt_mem_usage;
+
+/**
+ * @brief Reports the memory held by a general tree in O(1) time, from counters that the tree
+ * functions keep up to date.
+ * @param tree A general tree.
+ * @param usage Receives the breakdown.
+ * @return true if the breakdown was filled in.
+ * @note Arrays of children resized by calling expand_gt_pos() or shrink_gt_pos() directly,
+ * and positions freed with free_gt_pos(), are not reflected in the counters.
+ */
+bool gt_memory_usage(g_tree* tree, gt_mem_usage* usage);
+
+/**
+ * @brief Returns the growth policy trees start with: arrays double once they are 80% full,
+ * starting from DEFAULT_NUM_CHILDREN children, and never shrink.
+ * @return the default growth policy.
+ */
+gt_growth_policy gt_default_growth_policy();
+
+/**
+ * @brief Sets how the arrays of children of a general tree grow and shrink. Arrays keep their
+ * current capacity until they next grow or shrink.
+ * @param tree A general tree.
+ * @param policy The growth policy.
+ * @return true if the policy was set, false if it is invalid.
+ */
+bool gt_set_growth_policy(g_tree* tree, gt_growth_policy policy);
+
+/**
+ * @brief Shrinks the arrays of children whose load is below the policy's shrink load, and
+ * frees the arrays of positions without children, for trees with lazy shrinking or after a
+ * burst of removals. With a shrink load of 0, every array is trimmed to fit.
+ * @param tree A general tree.
+ * @return the number of arrays that were shrunk.
+ */
+unsigned int gt_compact_children(g_tree* tree);
+
+//////////////////////////////// END OF MEMORY FUNCTIONS ////////////////////////////////
 
 #endif // _DSA_GENERAL_TREE_H
\ No newline at end of file
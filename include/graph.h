@@ -0,0 +1,312 @@
+/**
+ * @brief This graph.h file contains the data structures and functions of a graph ADT in the
+ * adjacency list style: the graph keeps positional lists of its vertices and edges, and
+ * every vertex keeps a positional list of its outgoing edges and, in a directed graph, one
+ * of its incoming edges. Every edge remembers its positions in those lists, so edges and
+ * vertices are removed without searching. The struct that represents the graph is named
+ * "graph", its vertices "gr_vertex" and its edges "gr_edge".
+ *
+ * The adjacency lists are convenient to modify but slow to traverse, since every step
+ * follows a pointer to a separately allocated position. "graph_freeze" copies the structure
+ * of the graph into compressed sparse row (CSR) arrays, where the neighbours of each vertex
+ * are consecutive 32-bit vertex ids, and the traversals below run on that form, reading
+ * memory sequentially.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_GRAPH_H
+#define _DSA_GRAPH_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "positional_list.h"
+
+/// @brief The value of a vertex id or distance that stands for no vertex or no path.
+#define CSR_NONE UINT32_MAX
+
+
+////////////////////// GRAPH STRUCTURES //////////////////////
+
+/**
+ * @brief A vertex of a graph.
+ */
+typedef struct gr_vertex{
+
+    /// @brief A pointer to the data stored in the vertex.
+    void* data_ptr;
+
+    /// @brief The position of the vertex in the graph's list of vertices.
+    pl_pos* pos;
+
+    /// @brief The edges leaving the vertex; in an undirected graph, all its edges.
+    p_list* out;
+
+    /// @brief The edges entering the vertex, or null in an undirected graph.
+    p_list* in;
+
+    /// @brief The id of the vertex in the CSR form made by the last "graph_freeze".
+    uint32_t id;
+
+} gr_vertex;
+
+/**
+ * @brief An edge of a graph.
+ */
+typedef struct gr_edge{
+
+    /// @brief A pointer to the data stored in the edge.
+    void* data_ptr;
+
+    /// @brief The vertex the edge leaves, and the vertex it enters.
+    gr_vertex* origin;
+    gr_vertex* dest;
+
+    /// @brief The position of the edge in the origin's list of outgoing edges.
+    pl_pos* origin_pos;
+
+    /// @brief The position of the edge in the destination's list of incoming edges, or of
+    /// all its edges in an undirected graph; equal to "origin_pos" for a loop there.
+    pl_pos* dest_pos;
+
+    /// @brief The position of the edge in the graph's list of edges.
+    pl_pos* pos;
+
+} gr_edge;
+
+/**
+ * @brief A graph, directed or undirected.
+ */
+typedef struct graph{
+
+    /// @brief The vertices of the graph.
+    p_list* vertices;
+
+    /// @brief The edges of the graph.
+    p_list* edges;
+
+    /// @brief True if the edges have a direction.
+    bool directed;
+
+} graph;
+
+/**
+ * @brief The compressed sparse row form of a graph. The neighbours of vertex v are
+ * targets[offsets[v]] to targets[offsets[v + 1] - 1]. In an undirected graph every edge is
+ * listed in the rows of both its ends, a loop once.
+ */
+typedef struct gr_csr{
+
+    /// @brief The number of vertices.
+    uint32_t num_vertices;
+
+    /// @brief The number of entries of "targets".
+    uint32_t num_entries;
+
+    /// @brief True if the graph it was made from is directed.
+    bool directed;
+
+    /// @brief The start of every vertex's row, followed by "num_entries".
+    uint32_t* offsets;
+
+    /// @brief The ids of the neighbours, row after row.
+    uint32_t* targets;
+
+    /// @brief The edge of every entry of "targets".
+    gr_edge** edges;
+
+    /// @brief The vertex of every id.
+    gr_vertex** vertices;
+
+} gr_csr;
+
+////////////////////// END OF GRAPH STRUCTURES //////////////////////
+
+
+////////////////////// GRAPH FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates an empty graph.
+ * @param directed True for a directed graph.
+ * @return a pointer to the graph, or null if memory could not be allocated.
+ */
+graph* init_graph(bool directed);
+
+/**
+ * @brief Deallocates a graph with all its vertices and edges. The data stored in them is not
+ * deallocated.
+ * @param g A graph.
+ * @return null.
+ */
+graph* destroy_graph(graph* g);
+
+/**
+ * @brief Returns the number of vertices of the graph.
+ * @param g A graph.
+ * @return the number of vertices.
+ */
+uint gr_num_vertices(graph* g);
+
+/**
+ * @brief Returns the number of edges of the graph.
+ * @param g A graph.
+ * @return the number of edges.
+ */
+uint gr_num_edges(graph* g);
+
+/**
+ * @brief Adds a vertex to the graph.
+ * @param g A graph.
+ * @param data A pointer to the data to be stored in the vertex.
+ * @return the new vertex, or null if memory could not be allocated.
+ */
+gr_vertex* gr_insert_vertex(graph* g, void* data);
+
+/**
+ * @brief Adds an edge from one vertex to another. Parallel edges and loops are allowed.
+ * @param g A graph.
+ * @param origin The vertex the edge leaves.
+ * @param dest The vertex the edge enters.
+ * @param data A pointer to the data to be stored in the edge.
+ * @return the new edge, or null if memory could not be allocated.
+ */
+gr_edge* gr_insert_edge(graph* g, gr_vertex* origin, gr_vertex* dest, void* data);
+
+/**
+ * @brief Removes an edge from the graph in O(1) time.
+ * @param g A graph.
+ * @param e An edge of the graph.
+ * @return the data stored in the edge.
+ */
+void* gr_remove_edge(graph* g, gr_edge* e);
+
+/**
+ * @brief Removes a vertex and all its edges from the graph, in time proportional to its
+ * number of edges.
+ * @param g A graph.
+ * @param v A vertex of the graph.
+ * @return the data stored in the vertex.
+ */
+void* gr_remove_vertex(graph* g, gr_vertex* v);
+
+/**
+ * @brief Finds an edge from one vertex to another, or between them in an undirected graph,
+ * by scanning the shorter of the two adjacency lists.
+ * @param g A graph.
+ * @param origin A vertex of the graph.
+ * @param dest A vertex of the graph.
+ * @return the edge, or null if there is none.
+ */
+gr_edge* gr_get_edge(graph* g, gr_vertex* origin, gr_vertex* dest);
+
+/**
+ * @brief Returns the vertex at the other end of an edge.
+ * @param v One of the ends of the edge.
+ * @param e An edge.
+ * @return the other end, or null if v is not an end of the edge.
+ */
+gr_vertex* gr_opposite(gr_vertex* v, gr_edge* e);
+
+/**
+ * @brief Returns the number of edges leaving a vertex, or of all its edges in an undirected
+ * graph.
+ * @param v A vertex.
+ * @return the out degree.
+ */
+uint gr_out_degree(gr_vertex* v);
+
+/**
+ * @brief Returns the number of edges entering a vertex, or of all its edges in an undirected
+ * graph.
+ * @param v A vertex.
+ * @return the in degree.
+ */
+uint gr_in_degree(gr_vertex* v);
+
+////////////////////// END OF GRAPH FUNCTIONS //////////////////////
+
+
+////////////////////// CSR FUNCTIONS //////////////////////
+
+/**
+ * @brief Copies the structure of the graph into CSR arrays, in O(n + m) time. The vertices
+ * get the ids 0 to n - 1 in the order of the graph's list of vertices, stored in their "id"
+ * fields, and each row lists the vertex's edges in the order of its adjacency list.
+ * @param g A graph.
+ * @return the CSR form, or null if memory could not be allocated. It does not change when
+ * the graph does.
+ */
+gr_csr* graph_freeze(graph* g);
+
+/**
+ * @brief Deallocates the CSR form of a graph.
+ * @param csr A CSR form.
+ * @return null.
+ */
+gr_csr* destroy_csr(gr_csr* csr);
+
+/**
+ * @brief Runs a breadth-first search from a vertex.
+ * @param csr A CSR form.
+ * @param source The id of the start vertex.
+ * @param dist An array of "num_vertices" entries that receives the number of edges on a
+ * shortest path from the source to every vertex, CSR_NONE for the unreached ones.
+ * @param parent An array of "num_vertices" entries that receives the vertex before every
+ * vertex on such a path, CSR_NONE for the source and the unreached ones; may be null.
+ * @return the number of vertices reached, the source included.
+ */
+uint32_t csr_bfs(gr_csr* csr, uint32_t source, uint32_t* dist, uint32_t* parent);
+
+/**
+ * @brief Runs a breadth-first search from a vertex on several threads, one level at a time:
+ * the threads take chunks of the current level and claim unvisited neighbours with an
+ * atomic compare-and-swap, so every vertex joins the next level once. Which vertex becomes
+ * the parent of a vertex with several at the level above is not determined.
+ * @param csr A CSR form.
+ * @param source The id of the start vertex.
+ * @param dist As for "csr_bfs".
+ * @param parent As for "csr_bfs"; may be null.
+ * @param num_threads The number of threads, the calling one included; 0 for one per online
+ * processor.
+ * @return the number of vertices reached, the source included.
+ */
+uint32_t csr_parallel_bfs(gr_csr* csr, uint32_t source, uint32_t* dist, uint32_t* parent, uint32_t num_threads);
+
+/**
+ * @brief Runs a depth-first search from a vertex, with an explicit stack instead of
+ * recursion, visiting the neighbours of every vertex in row order.
+ * @param csr A CSR form.
+ * @param source The id of the start vertex.
+ * @param order An array of "num_vertices" entries that receives the ids of the reached
+ * vertices in the order they were discovered.
+ * @return the number of vertices reached, or 0 if memory could not be allocated.
+ */
+uint32_t csr_dfs(gr_csr* csr, uint32_t source, uint32_t* order);
+
+/**
+ * @brief Orders the vertices of a directed graph so that every edge goes from an earlier to
+ * a later vertex, with Kahn's algorithm.
+ * @param csr The CSR form of a directed graph.
+ * @param order An array of "num_vertices" entries that receives the ids in that order.
+ * @return true if the vertices were ordered, false if the graph has a cycle, is undirected
+ * or memory could not be allocated.
+ */
+bool csr_topological_sort(gr_csr* csr, uint32_t* order);
+
+/**
+ * @brief Finds the connected components of the graph, weakly connected ones for a directed
+ * graph, by merging the ends of every edge in a union-find forest.
+ * @param csr A CSR form.
+ * @param component An array of "num_vertices" entries that receives the component of every
+ * vertex, numbered from 0 in the order of their smallest vertex ids.
+ * @return the number of components, or 0 if memory could not be allocated.
+ */
+uint32_t csr_components(gr_csr* csr, uint32_t* component);
+
+////////////////////// END OF CSR FUNCTIONS //////////////////////
+
+#endif
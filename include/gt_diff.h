@@ -0,0 +1,130 @@
+/**
+ * @brief This gt_diff.h file contains the structures and interfaces for computing the
+ * structural difference between two general trees as a change script, and for applying a
+ * change script to a tree. It is used to keep a replica of a tree in sync by sending only
+ * what changed instead of the whole tree.
+ *
+ * The comparison uses the Merkle hashes of the subtrees (see gt_subtree_hash()): subtrees
+ * whose hashes are equal are skipped without being visited, so the cost of a diff is
+ * proportional to the number of positions on the paths to the changes, not to the size of
+ * the trees. Both trees must use the same data hash function.
+ *
+ * A change script is a sequence of edits that, applied in order, turns the old tree into the
+ * new one. Every edit addresses a position by its path from the root: an array of child
+ * indices, where the i-th index selects a child of the position at depth i, taken in the
+ * tree as it is when the edit is applied.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_GT_DIFF_H
+#define _DSA_GT_DIFF_H
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include "general_tree.h"
+
+
+/**
+ * @brief The kinds of edits of a change script.
+ */
+typedef enum gt_edit_kind{
+
+    /// @brief Inserts a leaf holding the data at the path. The last index of the path is the
+    /// index the new child takes among its siblings; an empty path adds the root.
+    GT_EDIT_INSERT,
+
+    /// @brief Removes the subtree at the path. An empty path removes every position.
+    GT_EDIT_DELETE,
+
+    /// @brief Replaces the data of the position at the path.
+    GT_EDIT_REPLACE
+
+} gt_edit_kind;
+
+/**
+ * @brief An edit of a change script.
+ */
+typedef struct gt_edit{
+
+    /// @brief The kind of the edit.
+    gt_edit_kind kind;
+
+    /// @brief The number of indices in the path of the edit.
+    unsigned int depth;
+
+    /// @brief The offset of the path of the edit in the path pool of the script.
+    unsigned int path_offset;
+
+    /// @brief The new data for insertions and replacements, null for deletions. The data is
+    /// shared with the new tree, not copied.
+    void* data_ptr;
+
+} gt_edit;
+
+/**
+ * @brief A change script: a sequence of edits and a single pool holding all their paths.
+ */
+typedef struct gt_script{
+
+    /// @brief An array of the edits, in the order they must be applied.
+    gt_edit* edits;
+
+    /// @brief The number of edits in the script.
+    unsigned int num_edits;
+
+    /// @brief The number of edits the array of edits has room for.
+    unsigned int edits_cap;
+
+    /// @brief The child indices of the paths of all the edits.
+    unsigned int* paths;
+
+    /// @brief The number of indices in the path pool.
+    unsigned int paths_len;
+
+    /// @brief The number of indices the path pool has room for.
+    unsigned int paths_cap;
+
+} gt_script;
+
+
+/**
+ * @brief Computes the change script that turns one general tree into another. An old tree
+ * that is a copy made with gt_clone() acts as a snapshot of an earlier state of the new one.
+ * @param old_tree The tree as the receiving side has it.
+ * @param new_tree The tree as it should become.
+ * @param equals A function that tells whether two data are equal, or null to compare the
+ * data pointers.
+ * @return the change script, or null if the trees do not share a data hash function or
+ * memory could not be allocated.
+ */
+gt_script* gt_diff(g_tree* old_tree, g_tree* new_tree, gt_key_equals equals);
+
+/**
+ * @brief Applies a change script to a general tree. Stops at the first edit whose path does
+ * not exist in the tree, leaving the edits before it applied.
+ * @param tree The general tree to modify, in the state the script was computed from.
+ * @param script A change script.
+ * @return true if every edit was applied, otherwise false.
+ */
+bool gt_apply_diff(g_tree* tree, gt_script* script);
+
+/**
+ * @brief Returns the path of an edit of a change script.
+ * @param script A change script.
+ * @param i The index of the edit.
+ * @return the child indices of the path, or null if the path is empty or i is out of range.
+ */
+const unsigned int* gt_edit_path(gt_script* script, unsigned int i);
+
+/**
+ * @brief Frees the memory used by a change script. The data it refers to is not freed.
+ * @param script A change script.
+ * @return null.
+ */
+gt_script* destroy_gt_script(gt_script* script);
+
+#endif
@@ -0,0 +1,154 @@
+/**
+ * @brief This handle_table.h file contains the structures and interfaces for a table of
+ * generation counted slots, which hands out 32-bit handles in place of raw pointers to
+ * positions. A handle packs the index of a slot with the generation the slot had when
+ * the handle was issued. Releasing a slot increments its generation, so a stale handle
+ * is detected in O(1) instead of being dereferenced, and the object a slot refers to can
+ * be relocated by updating the slot without invalidating any handle.
+ *
+ * @note All the functions run in O(1) time, amortized for "h_alloc".
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_HANDLE_TABLE_H
+#define _DSA_HANDLE_TABLE_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/// @brief The number of low bits of a handle that store the slot index.
+#define H_INDEX_BITS 24
+
+/// @brief Extracts the slot index from a handle.
+#define H_INDEX_MASK ((1u << H_INDEX_BITS) - 1)
+
+/// @brief The largest number of slots a table can have.
+#define H_MAX_SLOTS (1u << H_INDEX_BITS)
+
+/// @brief The number of distinct generations a slot goes through before repeating.
+#define H_GEN_MASK (0xFFFFFFFFu >> H_INDEX_BITS)
+
+/// @brief A handle that never refers to anything, since generation 0 is never issued.
+#define H_NULL 0u
+
+/// @brief Marks the end of the list of free slots.
+#define H_NO_SLOT 0xFFFFFFFFu
+
+/**
+ * @brief A 32-bit reference to an object stored in a handle table, made up of a slot index
+ * in the low H_INDEX_BITS bits and the slot's generation in the remaining high bits.
+ */
+typedef uint32_t h_handle;
+
+/**
+ * @brief A slot of the handle table.
+ */
+typedef struct h_slot{
+
+    /// @brief A pointer to the object the slot refers to, or null if the slot is free.
+    void* ptr;
+
+    /// @brief The current generation of the slot, never 0.
+    uint32_t gen;
+
+    /// @brief The index of the next free slot when this slot is free.
+    uint32_t next_free;
+
+} h_slot;
+
+/**
+ * @brief A growable array of generation counted slots.
+ */
+typedef struct h_table{
+
+    /// @brief The array of slots.
+    h_slot* slots;
+
+    /// @brief The number of slots that have been allocated for the array.
+    uint32_t capacity;
+
+    /// @brief The number of slots that have been used at least once.
+    uint32_t num_used;
+
+    /// @brief The number of slots currently referring to an object.
+    uint32_t num_live;
+
+    /// @brief The index of the first free slot, or H_NO_SLOT.
+    uint32_t free_head;
+
+} h_table;
+
+/**
+ * @brief Creates and initializes an empty handle table.
+ * @return a pointer to the newly created table, or null if allocation failed.
+ */
+h_table* init_h_table();
+
+/**
+ * @brief Deallocates the memory allocated to the handle table. The objects referred to
+ * by the slots are not deallocated.
+ * @param table A handle table.
+ * @return a null value indicating that the table is successfully deleted.
+ */
+h_table* destroy_h_table(h_table* table);
+
+/**
+ * @brief Stores a pointer in a free slot of the table.
+ * @param table A handle table.
+ * @param ptr A pointer to the object the handle refers to, must not be null.
+ * @return the handle of the slot, or H_NULL if the table is full or allocation failed.
+ */
+h_handle h_alloc(h_table* table, void* ptr);
+
+/**
+ * @brief Frees the slot referred to by the handle, so that the handle and all its copies
+ * become stale.
+ * @param table A handle table.
+ * @param handle A handle issued by the table.
+ * @return true if the slot was released, false if the handle was stale.
+ */
+bool h_release(h_table* table, h_handle handle);
+
+/**
+ * @brief Makes the slot referred to by the handle point to the new address of its object.
+ * @param table A handle table.
+ * @param handle A handle issued by the table.
+ * @param ptr The new address of the object.
+ * @return true if the slot was updated, false if the handle was stale.
+ */
+bool h_relocate(h_table* table, h_handle handle, void* ptr);
+
+/**
+ * @brief Returns the index of the slot a handle refers to.
+ */
+static inline uint32_t h_index(h_handle handle){
+    return handle & H_INDEX_MASK;
+}
+
+/**
+ * @brief Returns the generation stored in a handle.
+ */
+static inline uint32_t h_gen(h_handle handle){
+    return handle >> H_INDEX_BITS;
+}
+
+/**
+ * @brief Returns the object a handle refers to, checking that the handle is not stale.
+ * @param table A handle table.
+ * @param handle A handle issued by the table.
+ * @return a pointer to the object, or null if the handle is stale or H_NULL.
+ */
+static inline void* h_resolve(h_table* table, h_handle handle){
+
+    uint32_t index = h_index(handle);
+
+    if(table == NULL || index >= table->num_used || table->slots[index].gen != h_gen(handle))
+        return NULL;
+
+    return table->slots[index].ptr;
+}
+
+#endif // _DSA_HANDLE_TABLE_H
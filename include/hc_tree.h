@@ -0,0 +1,281 @@
+/**
+ * @brief This hc_tree.h file contains the structures and interfaces for an immutable,
+ * hash-consed general tree, for trees such as configurations that repeat the same subtrees
+ * many times. Its positions, named "hc_node", are kept in a store that holds at most one
+ * node for every distinct subtree: two subtrees are the same when their roots hold equal
+ * data and their children are the same subtrees, in the same order. Creating a node that the
+ * store already has returns the existing node with one more reference, so a subtree repeated
+ * k times takes the memory of one copy, and two subtrees of the same store are equal exactly
+ * when their nodes are the same pointer.
+ *
+ * A node never changes after it is created, and its array of children is part of the same
+ * allocation. Nodes are reference counted, by the parents and callers that hold them, and a
+ * node is removed from the store when its last reference is released.
+ *
+ * Trees are built bottom up, either with hc_make() from children that already exist, with a
+ * builder that receives the positions in pre-order as they are loaded, or from a general
+ * tree with hc_from_gt().
+ *
+ * @note A store, its nodes and its builders must only be used by one thread at a time.
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_HC_TREE_H
+#define _DSA_HC_TREE_H
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include "general_tree.h"
+
+/// @brief The number of slots of a new store.
+#define HC_INITIAL_SLOTS 64
+
+
+/**
+ * @brief A position of a hash-consed tree, shared by every subtree it is a copy of.
+ */
+typedef struct hc_node{
+
+    /// @brief A pointer to the data that is stored in this position.
+    void* data_ptr;
+
+    /**
+     * @brief The hash of the subtree, from the hash of the data and those of the children. It
+     * is the value gt_subtree_hash() gives a copy of the subtree with the same data hash.
+     */
+    size_t hash;
+
+    /// @brief The number of positions of the subtree, counting every copy of a shared one.
+    unsigned long size;
+
+    /// @brief The number of parent positions and callers that refer to this position.
+    unsigned int refcount;
+
+    /// @brief The number of children of this position.
+    unsigned int num_children;
+
+    /// @brief The children of this position, in order.
+    struct hc_node* children[];
+
+} hc_node;
+
+/**
+ * @brief The set of distinct subtrees, an open addressing hash table of nodes.
+ */
+typedef struct hc_store{
+
+    /// @brief The slots of the table, null when empty.
+    hc_node** slots;
+
+    /// @brief The number of slots, always a power of two.
+    unsigned int cap;
+
+    /// @brief The number of nodes in the store.
+    unsigned int count;
+
+    /// @brief The bytes held by the nodes.
+    size_t node_bytes;
+
+    /// @brief A pointer to the function that hashes the data of the positions.
+    gt_key_hash data_hash;
+
+    /// @brief A pointer to the function that compares the data of two positions.
+    gt_key_equals data_equals;
+
+} hc_store;
+
+/**
+ * @brief A position that a builder has started and not yet ended.
+ */
+typedef struct hc_frame{
+
+    /// @brief A pointer to the data of the position.
+    void* data_ptr;
+
+    /// @brief The index of its first child in the builder's stack of finished nodes.
+    unsigned int first_child;
+
+} hc_frame;
+
+/**
+ * @brief Builds a tree from its positions in pre-order, creating every subtree in the store
+ * as soon as it is complete, so that a repeated subtree is never held twice.
+ */
+typedef struct hc_builder{
+
+    /// @brief The store the nodes are created in.
+    hc_store* store;
+
+    /// @brief The positions started and not yet ended, innermost last.
+    hc_frame* open;
+    unsigned int num_open;
+    unsigned int open_cap;
+
+    /// @brief The finished subtrees waiting for their parent to end.
+    hc_node** done;
+    unsigned int num_done;
+    unsigned int done_cap;
+
+    /// @brief Set when memory could not be allocated or the positions were not nested.
+    bool failed;
+
+} hc_builder;
+
+
+//////////////////////////////// STORE FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief Creates an empty store.
+ * @param hash A pointer to the function that hashes the data stored in the positions.
+ * @param equals A pointer to the function that compares the data stored in two positions.
+ * @return a pointer to the store, or null if memory could not be allocated or a function is
+ * missing.
+ */
+hc_store* init_hc_store(gt_key_hash hash, gt_key_equals equals);
+
+/**
+ * @brief Deallocates a store and every node in it, whether or not it is still referenced.
+ * The data stored in the positions is not deallocated.
+ * @param store A store.
+ * @return null.
+ */
+hc_store* destroy_hc_store(hc_store* store);
+
+/**
+ * @brief Returns the number of distinct subtrees in the store.
+ * @param store A store.
+ * @return the number of nodes.
+ */
+unsigned int hc_store_size(hc_store* store);
+
+/**
+ * @brief Returns the number of bytes the store holds, its nodes and table included.
+ * @param store A store.
+ * @return the number of bytes.
+ */
+size_t hc_memory_usage(hc_store* store);
+
+//////////////////////////////// END OF STORE FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// NODE FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief Returns the node with the given data and children, creating it only if the store
+ * does not have it yet.
+ * @param store A store.
+ * @param data A pointer to the data of the position.
+ * @param children The children of the position, in order, nodes of the same store. The
+ * caller's references to them pass to the returned node, or are released on failure.
+ * @param n The number of children.
+ * @return the node, with a reference for the caller, or null if memory could not be
+ * allocated.
+ */
+hc_node* hc_make(hc_store* store, void* data, hc_node** children, unsigned int n);
+
+/**
+ * @brief Adds a reference to a node.
+ * @param node A node.
+ * @return the node.
+ */
+hc_node* hc_retain(hc_node* node);
+
+/**
+ * @brief Drops a reference to a node, removing it from the store and deallocating it, and in
+ * turn every descendant whose last reference it held, once no reference is left.
+ * @param store The store of the node.
+ * @param node A node.
+ * @return null.
+ */
+hc_node* hc_release(hc_store* store, hc_node* node);
+
+/**
+ * @brief Checks if two subtrees of the same store are equal, in O(1) time.
+ * @return true if they have equal data and equal children, in the same order.
+ */
+static inline bool hc_equals(hc_node* a, hc_node* b){
+    return a == b;
+}
+
+/**
+ * @brief Returns a pointer to the data stored in a position.
+ */
+void* hc_element(hc_node* node);
+
+/**
+ * @brief Returns the i-th child of a position, or null if it has fewer children.
+ */
+hc_node* hc_child(hc_node* node, unsigned int i);
+
+/**
+ * @brief Returns the number of children of a position.
+ */
+unsigned int hc_num_children(hc_node* node);
+
+/**
+ * @brief Returns the number of positions of the subtree rooted at a position, as if every
+ * shared subtree were copied out.
+ */
+unsigned long hc_size(hc_node* node);
+
+//////////////////////////////// END OF NODE FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// BUILDER FUNCTIONS ////////////////////////////////
+
+/**
+ * @brief Creates a builder of one tree.
+ * @param store The store the nodes are created in.
+ * @return a pointer to the builder, or null if memory could not be allocated.
+ */
+hc_builder* init_hc_builder(hc_store* store);
+
+/**
+ * @brief Starts a position, the child of the innermost position started and not ended, or
+ * the root if there is none.
+ * @param builder A builder.
+ * @param data A pointer to the data of the position.
+ * @return false if the builder has failed.
+ */
+bool hc_begin(hc_builder* builder, void* data);
+
+/**
+ * @brief Ends the innermost position started, whose children have all been ended, and puts
+ * its subtree in the store.
+ * @param builder A builder.
+ * @return false if the builder has failed.
+ */
+bool hc_end(hc_builder* builder);
+
+/**
+ * @brief Deallocates a builder and returns the tree it built.
+ * @param builder A builder.
+ * @return the root of the tree, with a reference for the caller, or null if the builder
+ * failed or did not build exactly one complete tree, in which case the nodes it made are
+ * released.
+ */
+hc_node* hc_finish(hc_builder* builder);
+
+/**
+ * @brief Builds the hash-consed copy of a general tree.
+ * @param store A store whose functions apply to the data of the tree.
+ * @param tree A general tree.
+ * @return the root of the copy, with a reference for the caller, or null if the tree is empty
+ * or memory could not be allocated.
+ */
+hc_node* hc_from_gt(hc_store* store, g_tree* tree);
+
+/**
+ * @brief Copies a hash-consed tree out into a general tree, every shared subtree becoming
+ * separate positions.
+ * @param node The root of a hash-consed tree.
+ * @return the general tree, or null if memory could not be allocated.
+ */
+g_tree* hc_to_gt(hc_node* node);
+
+//////////////////////////////// END OF BUILDER FUNCTIONS ////////////////////////////////
+
+#endif // _DSA_HC_TREE_H
@@ -0,0 +1,283 @@
+/**
+ * @brief This lru_cache.h file contains the data structures and functions that implement
+ * a Least Recently Used (LRU) cache on top of the positional list ADT. The positional list
+ * keeps the entries in recency order, most recently used first, and an open addressing hash
+ * index maps keys to the positions of their entries. A hit relinks the existing position to
+ * the front of the list with "pl_move_first", and when the cache is full the position of the
+ * least recently used entry is recycled for the new entry, so a cache at capacity does not
+ * allocate or deallocate memory.
+ * Lookups, insertions and removals run in O(1) expected time.
+ *
+ * A sharded variant splits the keys over several independently locked caches, so that
+ * threads accessing different shards do not contend for the same lock.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_LRU_CACHE_H
+#define _DSA_LRU_CACHE_H
+
+#include <stdlib.h>
+#include <pthread.h>
+#include "positional_list.h"
+
+
+////////////////////// FUNCTION POINTERS //////////////////////
+
+/**
+ * @brief Stores a reference to a function that computes the hash code of a key.
+ * @param key A pointer to the key.
+ * @return the hash code of the key.
+ */
+typedef size_t (*lru_hash)(void* key);
+
+/**
+ * @brief Stores a reference to a function that checks if two keys are equal.
+ * @param key_a A pointer to a key.
+ * @param key_b A pointer to a key.
+ * @return true if the keys are equal, otherwise false.
+ */
+typedef BOOL (*lru_equals)(void* key_a, void* key_b);
+
+/**
+ * @brief Stores a reference to a function that is called when an entry leaves the cache,
+ * either because it was evicted or because the cache was destroyed.
+ * @param key A pointer to the key of the entry.
+ * @param value A pointer to the value of the entry.
+ * @param ctx A pointer to caller supplied state, passed through unchanged.
+ */
+typedef void (*lru_evict)(void* key, void* value, void* ctx);
+
+////////////////////// END OF FUNCTION POINTERS //////////////////////
+
+
+////////////////////// LRU CACHE STRUCTURES //////////////////////
+
+/**
+ * @brief An entry of the cache, stored as the element of a position of the recency list.
+ */
+typedef struct lru_entry{
+
+    /// @brief A pointer to the key of the entry.
+    void* key;
+
+    /// @brief A pointer to the value of the entry.
+    void* value;
+
+    /// @brief The hash code of the key, cached so the index never rehashes a key.
+    size_t hash;
+
+} lru_entry;
+
+/**
+ * @brief A least recently used cache with a fixed capacity.
+ */
+typedef struct lru_cache{
+
+    /// @brief The positions of the entries, from the most to the least recently used.
+    p_list* order;
+
+    /// @brief An open addressing table of the positions of the entries.
+    pl_pos** index;
+
+    /// @brief The number of slots of the index, always a power of two.
+    uint index_cap;
+
+    /// @brief The number of slots of the index that hold a removed entry marker.
+    uint num_removed;
+
+    /// @brief The maximum number of entries the cache holds.
+    uint capacity;
+
+    /// @brief A pointer to the function that hashes keys.
+    lru_hash hash;
+
+    /// @brief A pointer to the function that compares keys.
+    lru_equals equals;
+
+    /// @brief A pointer to the function called for entries leaving the cache, or null.
+    lru_evict evict;
+
+    /// @brief The state passed to the evict function.
+    void* evict_ctx;
+
+} lru_cache;
+
+/**
+ * @brief A cache made up of several independently locked LRU caches. Each key always maps
+ * to the same shard, and each shard holds at most its share of the total capacity.
+ */
+typedef struct lru_sharded{
+
+    /// @brief The caches that make up the shards.
+    lru_cache** shards;
+
+    /// @brief The locks that guard the shards, one per shard.
+    pthread_mutex_t* locks;
+
+    /// @brief The number of shards.
+    uint num_shards;
+
+    /// @brief A pointer to the function that hashes keys.
+    lru_hash hash;
+
+} lru_sharded;
+
+////////////////////// END OF LRU CACHE STRUCTURES //////////////////////
+
+
+////////////////////// LRU CACHE FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates and initializes an LRU cache.
+ * @param capacity The maximum number of entries, at least 1.
+ * @param hash A pointer to the function that hashes keys.
+ * @param equals A pointer to the function that compares keys.
+ * @param evict A pointer to the function called for every entry leaving the cache, or null.
+ * @param ctx A pointer to caller supplied state passed to the evict function.
+ * @return the address of the newly created cache, or null if allocation failed.
+ */
+lru_cache* init_lru(uint capacity, lru_hash hash, lru_equals equals, lru_evict evict, void* ctx);
+
+/**
+ * @brief Deallocates the memory that was allocated to the cache, calling the evict function
+ * for each remaining entry.
+ * @param cache An LRU cache.
+ * @return a null value indicating that the cache is successfully deleted.
+ */
+lru_cache* destroy_lru(lru_cache* cache);
+
+/**
+ * @brief Returns the value stored for the key and marks the entry as the most recently used.
+ * @param key A pointer to the key.
+ * @param cache An LRU cache.
+ * @return the value stored for the key, or null if the key is not in the cache.
+ */
+void* lru_get(void* key, lru_cache* cache);
+
+/**
+ * @brief Returns the value stored for the key without changing the recency of the entry.
+ * @param key A pointer to the key.
+ * @param cache An LRU cache.
+ * @return the value stored for the key, or null if the key is not in the cache.
+ */
+void* lru_peek(void* key, lru_cache* cache);
+
+/**
+ * @brief Stores a value for the key as the most recently used entry. If the key is already
+ * in the cache, its value is replaced and the stored key is kept. Otherwise, if the cache is
+ * full, the least recently used entry is evicted first.
+ * @param key A pointer to the key.
+ * @param value A pointer to the value.
+ * @param cache An LRU cache.
+ * @return the value formerly stored for the key, or null if the key was not in the cache.
+ */
+void* lru_put(void* key, void* value, lru_cache* cache);
+
+/**
+ * @brief Removes the entry for the key without calling the evict function.
+ * @param key A pointer to the key.
+ * @param cache An LRU cache.
+ * @return the value stored for the key, or null if the key is not in the cache.
+ */
+void* lru_remove(void* key, lru_cache* cache);
+
+/**
+ * @brief Returns the number of entries in the cache.
+ * @param cache An LRU cache.
+ * @return the number of entries in the cache.
+ */
+uint lru_size(lru_cache* cache);
+
+////////////////////// END OF LRU CACHE FUNCTIONS //////////////////////
+
+
+////////////////////// SHARDED LRU CACHE FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates and initializes a sharded LRU cache that is safe to use from multiple threads.
+ * @param num_shards The number of shards, at least 1.
+ * @param capacity The maximum number of entries over all shards.
+ * @param hash A pointer to the function that hashes keys.
+ * @param equals A pointer to the function that compares keys.
+ * @param evict A pointer to the function called for every entry leaving the cache, or null.
+ * It is called while the shard's lock is held.
+ * @param ctx A pointer to caller supplied state passed to the evict function.
+ * @return the address of the newly created cache, or null if allocation failed.
+ */
+lru_sharded* init_lru_sharded(uint num_shards, uint capacity, lru_hash hash, lru_equals equals, lru_evict evict, void* ctx);
+
+/**
+ * @brief Deallocates the memory that was allocated to the sharded cache, calling the evict
+ * function for each remaining entry. No other thread may be using the cache.
+ * @param cache A sharded LRU cache.
+ * @return a null value indicating that the cache is successfully deleted.
+ */
+lru_sharded* destroy_lru_sharded(lru_sharded* cache);
+
+/**
+ * @brief Returns the value stored for the key and marks the entry as the most recently used
+ * in its shard.
+ * @param key A pointer to the key.
+ * @param cache A sharded LRU cache.
+ * @return the value stored for the key, or null if the key is not in the cache.
+ * @note The value may be evicted by another thread once the call returns; values that are
+ * shared between threads must be freed by the evict function only when no reader holds them.
+ */
+void* lru_sh_get(void* key, lru_sharded* cache);
+
+/**
+ * @brief Stores a value for the key in its shard, as "lru_put" does.
+ * @param key A pointer to the key.
+ * @param value A pointer to the value.
+ * @param cache A sharded LRU cache.
+ * @return the value formerly stored for the key, or null if the key was not in the cache.
+ */
+void* lru_sh_put(void* key, void* value, lru_sharded* cache);
+
+/**
+ * @brief Removes the entry for the key from its shard without calling the evict function.
+ * @param key A pointer to the key.
+ * @param cache A sharded LRU cache.
+ * @return the value stored for the key, or null if the key is not in the cache.
+ */
+void* lru_sh_remove(void* key, lru_sharded* cache);
+
+/**
+ * @brief Returns the number of entries over all shards.
+ * @param cache A sharded LRU cache.
+ * @return the number of entries in the cache.
+ */
+uint lru_sh_size(lru_sharded* cache);
+
+////////////////////// END OF SHARDED LRU CACHE FUNCTIONS //////////////////////
+
+
+////////////////////// HASH FUNCTIONS //////////////////////
+
+/**
+ * @brief Hashes a key that is a string (char*), with 64-bit FNV-1a.
+ */
+size_t lru_str_hash(void* key);
+
+/**
+ * @brief Checks if two string (char*) keys are equal.
+ */
+BOOL lru_str_equals(void* key_a, void* key_b);
+
+/**
+ * @brief Hashes a key that is a pointer to a long.
+ */
+size_t lru_long_hash(void* key);
+
+/**
+ * @brief Checks if two keys that are pointers to longs are equal.
+ */
+BOOL lru_long_equals(void* key_a, void* key_b);
+
+////////////////////// END OF HASH FUNCTIONS //////////////////////
+
+#endif // _DSA_LRU_CACHE_H
@@ -0,0 +1,281 @@
+/**
+ * @brief This mapped_list.h file contains the data structures and functions of a persistent
+ * positional list, named "mm_list", whose positions live in a memory-mapped file. A position
+ * is addressed by its offset in the file rather than by its address, and links to the
+ * positions next to it by offset too, so the file can be mapped at any address: a process
+ * that restarts reopens the list by mapping the file, in O(1) time, instead of rebuilding it
+ * element by element.
+ *
+ * Every position holds a copy of its element, of the fixed size the list was created with.
+ * Positions are allocated inside the file, from a list of freed positions or else from the
+ * end of the used space, and the file grows when it is full.
+ *
+ * Changes are made to a private mapping, so the file only changes at a checkpoint. A
+ * checkpoint writes the pages changed since the one before to a journal next to the file
+ * and syncs it, then writes them into the file and syncs that. When a process stops in the
+ * middle of a checkpoint, the next open completes it from the journal, or ignores a journal
+ * that was not completely written; either way the list is as it was after a checkpoint.
+ *
+ * @note A list can only be opened by one process at a time, and used by one thread at a time.
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_MAPPED_LIST_H
+#define _DSA_MAPPED_LIST_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "positional_list.h"
+
+/// @brief The offset of a position in the file, or MM_NULL for no position.
+typedef uint64_t mm_off;
+
+/// @brief The offset that refers to no position.
+#define MM_NULL 0
+
+/// @brief The "prev" link of a position on the list of freed positions.
+#define MM_FREED UINT64_MAX
+
+/// @brief The size of a new file; files grow by doubling, in multiples of this size.
+#define MM_INITIAL_SIZE (1UL << 20)
+
+/// @brief The most a file grows by at once.
+#define MM_MAX_GROWTH (1UL << 30)
+
+/// @brief The offset of the first position, just after the file header.
+#define MM_DATA_START 128
+
+/// @brief The version of the file layout.
+#define MM_FORMAT 1
+
+
+////////////////////// MAPPED LIST STRUCTURES //////////////////////
+
+/**
+ * @brief The header at the start of the file, which describes the list.
+ */
+typedef struct mm_header{
+
+    /// @brief "DSAMLIST", identifies the file.
+    char magic[8];
+
+    /// @brief The version of the layout, MM_FORMAT.
+    uint64_t format;
+
+    /// @brief The number of bytes of an element, and of a position with its links.
+    uint64_t elem_size;
+    uint64_t node_size;
+
+    /// @brief The size of the file.
+    uint64_t file_size;
+
+    /// @brief The offset past the last position ever allocated.
+    uint64_t bump;
+
+    /// @brief The first position on the list of freed positions, linked by "next".
+    mm_off free_head;
+
+    /// @brief The first and last position of the list.
+    mm_off head;
+    mm_off tail;
+
+    /// @brief The number of elements in the list.
+    uint64_t num_elements;
+
+    /// @brief The number of checkpoints taken since the file was created.
+    uint64_t checkpoints;
+
+} mm_header;
+
+/**
+ * @brief A position of a mapped list, as it is laid out in the file.
+ */
+typedef struct mm_pos{
+
+    /// @brief The offset of the next position, or MM_NULL at the end.
+    mm_off next;
+
+    /// @brief The offset of the previous position, MM_NULL at the front, or MM_FREED.
+    mm_off prev;
+
+    /// @brief The element, "elem_size" bytes rounded up to a multiple of 8.
+    unsigned char data[];
+
+} mm_pos;
+
+/**
+ * @brief An open mapped list.
+ */
+typedef struct mm_list{
+
+    /// @brief The file of the list, and its journal.
+    int fd;
+    int journal_fd;
+
+    /// @brief The private mapping of the whole file; it moves when the file grows.
+    unsigned char* base;
+
+    /// @brief The size of the system's pages.
+    size_t page_size;
+
+    /// @brief One bit per page of the file, set for the pages changed since the last checkpoint.
+    uint8_t* dirty_bits;
+
+    /// @brief The pages whose bit is set, as page numbers, in the order they were changed.
+    uint64_t* dirty_pages;
+    size_t num_dirty;
+    size_t dirty_cap;
+
+} mm_list;
+
+////////////////////// END OF MAPPED LIST STRUCTURES //////////////////////
+
+
+////////////////////// MAPPED LIST FUNCTIONS //////////////////////
+
+/**
+ * @brief Opens the mapped list stored in a file, or creates an empty one if the file does not
+ * exist or is empty. A file that is not empty and does not hold a mapped list is rejected and
+ * left as it is. An interrupted checkpoint is completed or discarded first.
+ * @param path The path of the file; the journal is the same path followed by ".journal".
+ * @param elem_size The number of bytes of an element. It must be the size the list was
+ * created with, or 0 to accept that size when the file exists.
+ * @return the list, or null if the file could not be opened or mapped, is not a mapped list,
+ * has another element size, or is open in another process.
+ */
+mm_list* mm_open(const char* path, uint elem_size);
+
+/**
+ * @brief Takes a checkpoint, then unmaps and closes the list. The list is closed even if
+ * the checkpoint fails.
+ * @param list A mapped list.
+ * @return true if the checkpoint was written, false if it failed, in which case the changes
+ * since the checkpoint before it are lost.
+ */
+BOOL mm_close(mm_list* list);
+
+/**
+ * @brief Makes the current state of the list durable. If the process stops at any point
+ * after this call returns, the next open finds the list in this state or in the state of a
+ * later checkpoint.
+ * @param list A mapped list.
+ * @return true if the checkpoint was written, false if a write or sync failed. The changes
+ * then remain in memory, and the next open finds the list as of this checkpoint or the one
+ * before it.
+ */
+BOOL mm_checkpoint(mm_list* list);
+
+/**
+ * @brief Returns the number of elements in the list.
+ */
+unsigned long mm_size(mm_list* list);
+
+/**
+ * @brief Checks if the list has no elements.
+ */
+BOOL mm_is_empty(mm_list* list);
+
+/**
+ * @brief Returns the number of bytes of an element.
+ */
+uint mm_elem_size(mm_list* list);
+
+/**
+ * @brief Returns the first position of the list, or MM_NULL if it is empty.
+ */
+mm_off mm_first(mm_list* list);
+
+/**
+ * @brief Returns the last position of the list, or MM_NULL if it is empty.
+ */
+mm_off mm_last(mm_list* list);
+
+/**
+ * @brief Returns the position after a position, or MM_NULL if it is the last one or is not a
+ * position of the list.
+ */
+mm_off mm_after(mm_list* list, mm_off pos);
+
+/**
+ * @brief Returns the position before a position, or MM_NULL if it is the first one or is not
+ * a position of the list.
+ */
+mm_off mm_before(mm_list* list, mm_off pos);
+
+/**
+ * @brief Returns a pointer to the element stored in a position.
+ * @param list A mapped list.
+ * @param pos A position of the list.
+ * @return the element, or null if pos is not a position of the list. The pointer is only
+ * valid until the next element is added, which may move the mapping, and the element must
+ * only be changed with mm_set().
+ */
+const void* mm_get(mm_list* list, mm_off pos);
+
+/**
+ * @brief Replaces the element stored in a position.
+ * @param list A mapped list.
+ * @param pos A position of the list.
+ * @param elem_ptr A pointer to the new element, of the list's element size.
+ * @return true if the element was replaced.
+ */
+BOOL mm_set(mm_list* list, mm_off pos, const void* elem_ptr);
+
+/**
+ * @brief Adds a copy of an element at the front of the list.
+ * @return the new position, or MM_NULL if the file could not grow.
+ */
+mm_off mm_add_first(mm_list* list, const void* elem_ptr);
+
+/**
+ * @brief Adds a copy of an element at the back of the list.
+ * @return the new position, or MM_NULL if the file could not grow.
+ */
+mm_off mm_add_last(mm_list* list, const void* elem_ptr);
+
+/**
+ * @brief Adds a copy of an element just before a position.
+ * @return the new position, or MM_NULL if pos is not a position of the list or the file
+ * could not grow.
+ */
+mm_off mm_add_before(mm_list* list, mm_off pos, const void* elem_ptr);
+
+/**
+ * @brief Adds a copy of an element just after a position.
+ * @return the new position, or MM_NULL if pos is not a position of the list or the file
+ * could not grow.
+ */
+mm_off mm_add_after(mm_list* list, mm_off pos, const void* elem_ptr);
+
+/**
+ * @brief Removes a position from the list and frees it for reuse.
+ * @param list A mapped list.
+ * @param pos A position of the list.
+ * @param elem_ptr Receives a copy of the element, or null.
+ * @return true if the position was removed.
+ */
+BOOL mm_delete(mm_list* list, mm_off pos, void* elem_ptr);
+
+/**
+ * @brief Applies a function to each element, from the first to the last.
+ * @param list A mapped list.
+ * @param func A pointer to the function, which must not change the elements.
+ * @param ctx A pointer passed to each call of func.
+ */
+void mm_for_each(mm_list* list, ptr_visit func, void* ctx);
+
+/**
+ * @brief Appends a copy of each element of a positional list, in order.
+ * @param list A mapped list.
+ * @param src A positional list whose elements point to values of the list's element size.
+ * @return the number of elements appended, less than the size of src if the file could not
+ * grow.
+ */
+uint mm_append_p_list(mm_list* list, p_list* src);
+
+////////////////////// END OF MAPPED LIST FUNCTIONS //////////////////////
+
+#endif
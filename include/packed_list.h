@@ -0,0 +1,219 @@
+/**
+ * @brief This packed_list.h file contains the data structures and functions of a compressed
+ * sequence of integers, named "pk_list", for data such as timestamps that a positional list
+ * of "long" elements would store at the cost of a position and a heap cell per element.
+ * The values are split into blocks of PK_BLOCK_VALUES. Within a block, every value is stored
+ * as the difference from the value before it, zigzag encoded so that small negative
+ * differences stay small, and written as a varint of 7 bits per byte. Sorted or slowly
+ * changing data therefore takes one or two bytes per value.
+ * Every block also records its first, smallest and largest value, so that a search skips
+ * the blocks that cannot hold the value without decoding them.
+ *
+ * Values are appended at the end and read in order with an iterator that decodes them as it
+ * goes; reading the value at an index decodes at most one block.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_PACKED_LIST_H
+#define _DSA_PACKED_LIST_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "positional_list.h"
+
+/// @brief The number of values in a full block.
+#define PK_BLOCK_VALUES 128
+
+/// @brief The most bytes a varint of a 64-bit value takes.
+#define PK_MAX_VARINT 10
+
+
+////////////////////// PACKED LIST STRUCTURES //////////////////////
+
+/**
+ * @brief The summary of a block of values.
+ */
+typedef struct pk_block{
+
+    /// @brief The first value of the block, stored here rather than in the bytes.
+    long first;
+
+    /// @brief The smallest and largest value of the block.
+    long min;
+    long max;
+
+    /// @brief The offset of the block's encoded differences in the list's bytes.
+    uint offset;
+
+    /// @brief The number of values in the block.
+    uint count;
+
+} pk_block;
+
+/**
+ * @brief A compressed, append only sequence of integers.
+ */
+typedef struct pk_list{
+
+    /// @brief The summaries of the blocks, in order; only the last block is not full.
+    pk_block* blocks;
+
+    /// @brief The number of blocks, and the number the array has room for.
+    uint num_blocks;
+    uint blocks_cap;
+
+    /// @brief The encoded differences of all the blocks, block after block.
+    uint8_t* bytes;
+
+    /// @brief The number of bytes in use, and the number the array has room for.
+    uint num_bytes;
+    uint bytes_cap;
+
+    /// @brief The number of values in the list.
+    uint num_elements;
+
+    /// @brief The last value appended, the base of the next difference.
+    long last;
+
+    /// @brief TRUE while every value is at least the one before it.
+    BOOL sorted;
+
+} pk_list;
+
+/**
+ * @brief A forward traversal of a packed list that decodes the values as it goes.
+ * @note Appending to the list while an iterator is in use is allowed; the iterator then
+ * also produces the new values.
+ */
+typedef struct pk_iter{
+
+    /// @brief The block of the next value.
+    uint block;
+
+    /// @brief The index of the next value within its block.
+    uint index;
+
+    /// @brief The offset of the next encoded difference.
+    uint offset;
+
+    /// @brief The value produced last.
+    long value;
+
+} pk_iter;
+
+////////////////////// END OF PACKED LIST STRUCTURES //////////////////////
+
+
+////////////////////// PACKED LIST FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates an empty packed list.
+ * @return a pointer to the list, or null if memory could not be allocated.
+ */
+pk_list* init_pk_list();
+
+/**
+ * @brief Deallocates a packed list.
+ * @param list A packed list.
+ * @return null.
+ */
+pk_list* destroy_pk_list(pk_list* list);
+
+/**
+ * @brief Returns the number of values in the list.
+ * @param list A packed list.
+ * @return the number of values.
+ */
+uint pk_size(pk_list* list);
+
+/**
+ * @brief Checks if every value of the list is at least the one before it.
+ * @param list A packed list.
+ * @return true if the values are sorted.
+ */
+BOOL pk_is_sorted(pk_list* list);
+
+/**
+ * @brief Appends a value at the end of the list, in amortized O(1) time.
+ * @param list A packed list.
+ * @param value The value.
+ * @return true if the value was appended, false if memory could not be allocated or the
+ * list is full: it holds at most UINT_MAX values, in at most UINT_MAX bytes of differences.
+ */
+BOOL pk_append(pk_list* list, long value);
+
+/**
+ * @brief Returns the value at an index, decoding at most one block.
+ * @param list A packed list.
+ * @param i The index, counting from 0.
+ * @param value Receives the value.
+ * @return true if i is in range.
+ */
+BOOL pk_get(pk_list* list, uint i, long* value);
+
+/**
+ * @brief Returns an iterator at the first value of the list.
+ * @param list A packed list.
+ * @return the iterator.
+ */
+pk_iter pk_iter_begin(pk_list* list);
+
+/**
+ * @brief Produces the next value of an iterator.
+ * @param iter A pointer to an iterator over the list.
+ * @param list A packed list.
+ * @param value Receives the value.
+ * @return true if a value was produced, false at the end of the list.
+ */
+BOOL pk_iter_next(pk_iter* iter, pk_list* list, long* value);
+
+/**
+ * @brief Decodes a run of consecutive values into an array, a block at a time.
+ * @param list A packed list.
+ * @param start The index of the first value.
+ * @param out An array that receives up to n values.
+ * @param n The maximum number of values to decode.
+ * @return the number of values decoded, less than n only at the end of the list.
+ */
+uint pk_decode(pk_list* list, uint start, long* out, uint n);
+
+/**
+ * @brief Finds the first occurrence of a value, decoding only the blocks whose smallest and
+ * largest values enclose it.
+ * @param list A packed list.
+ * @param value The value to look for.
+ * @return the index of the value, or -1 if the list does not have it.
+ */
+long pk_find(pk_list* list, long value);
+
+/**
+ * @brief Finds the first value that is not less than a given value in a sorted list, with a
+ * binary search over the blocks and a scan of one block.
+ * @param list A packed list whose values are sorted.
+ * @param value The value to compare with.
+ * @return the index of that value, the size of the list if every value is less, or -1 if
+ * the list is not sorted.
+ */
+long pk_lower_bound(pk_list* list, long value);
+
+/**
+ * @brief Builds a packed list from the "long" elements of a positional list.
+ * @param list A positional list whose elements point to "long" values.
+ * @return the packed list, or null if memory could not be allocated.
+ */
+pk_list* pk_from_p_list(p_list* list);
+
+/**
+ * @brief Returns the number of bytes the list holds, its structure included.
+ * @param list A packed list.
+ * @return the number of bytes.
+ */
+size_t pk_memory_usage(pk_list* list);
+
+////////////////////// END OF PACKED LIST FUNCTIONS //////////////////////
+
+#endif
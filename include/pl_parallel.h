@@ -0,0 +1,147 @@
+/**
+ * @brief This pl_parallel.h file contains the data structures and functions that scan a
+ * positional list on several threads. The list is split into balanced ranges of consecutive
+ * positions, and the threads of a pool take ranges until none are left, so a thread that
+ * finishes early helps with the rest. The first position of every range is found with
+ * "pl_at" when the list has a rank index, in O(r log n) time for r ranges, and otherwise
+ * with one pass that records every k-th position. The ranges are cached in the list and
+ * reused by later scans until the list is modified.
+ *
+ * A scan must not run while the list is being modified, and the functions it calls must be
+ * safe to call from several threads at once.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_PL_PARALLEL_H
+#define _DSA_PL_PARALLEL_H
+
+#include <stdlib.h>
+#include <pthread.h>
+#include "positional_list.h"
+
+/// @brief The number of ranges per thread a list is split into, so that uneven work evens out.
+#define PL_PARALLEL_RANGES_PER_THREAD 4
+
+/// @brief Lists with fewer elements than this are scanned by the calling thread alone.
+#define PL_PARALLEL_MIN_ELEMENTS 4096
+
+
+////////////////////// FUNCTION POINTERS //////////////////////
+
+/**
+ * @brief Stores a reference to a function that tests an element.
+ * @param elem_ptr A pointer to the element.
+ * @param ctx A pointer to caller supplied state, passed through unchanged.
+ * @return true if the element passes the test.
+ */
+typedef BOOL (*ptr_predicate)(void* elem_ptr, void* ctx);
+
+////////////////////// END OF FUNCTION POINTERS //////////////////////
+
+
+////////////////////// THREAD POOL STRUCTURE //////////////////////
+
+/**
+ * @brief A pool of worker threads that run the scans. The thread that starts a scan works
+ * on it too, so a pool of t threads scans with t + 1 threads. A pool runs one scan at a time;
+ * concurrent calls on the same pool wait for each other.
+ */
+typedef struct pl_pool{
+
+    /// @brief The worker threads.
+    pthread_t* threads;
+
+    /// @brief The number of worker threads.
+    uint num_threads;
+
+    /// @brief Serializes the scans that use the pool.
+    pthread_mutex_t run_lock;
+
+    /// @brief Protects the fields below.
+    pthread_mutex_t lock;
+
+    /// @brief Signals the workers that a scan was posted or that the pool is shutting down.
+    pthread_cond_t work_posted;
+
+    /// @brief Signals the thread that posted a scan that the last worker left it.
+    pthread_cond_t work_done;
+
+    /// @brief The scan being run, or null.
+    struct pl_job* job;
+
+    /// @brief Incremented for every posted scan, so that a worker joins each scan once.
+    unsigned long generation;
+
+    /// @brief The number of workers still working on the current scan.
+    uint active;
+
+    /// @brief Set when the pool is being destroyed.
+    BOOL stop;
+
+} pl_pool;
+
+////////////////////// END OF THREAD POOL STRUCTURE //////////////////////
+
+
+////////////////////// THREAD POOL FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates a pool of worker threads.
+ * @param num_threads The number of worker threads, or 0 for one less than the number of
+ * online processors, so that with the calling thread every processor is used.
+ * @return a pointer to the pool, or null if it could not be created.
+ */
+pl_pool* init_pl_pool(uint num_threads);
+
+/**
+ * @brief Stops the worker threads and deallocates a pool.
+ * @param pool A pool that is not running a scan.
+ * @return null.
+ */
+pl_pool* destroy_pl_pool(pl_pool* pool);
+
+////////////////////// END OF THREAD POOL FUNCTIONS //////////////////////
+
+
+////////////////////// PARALLEL FUNCTIONS //////////////////////
+
+/**
+ * @brief Applies a function to every element of the list, on the threads of a pool. The
+ * elements of a range are visited in list order, but the ranges are visited in any order
+ * and at the same time.
+ * @param list A positional list.
+ * @param func A pointer to a function applied to each element.
+ * @param ctx A pointer to caller supplied state passed to every call of func.
+ * @param pool A pool, or null to scan on the calling thread.
+ */
+void pl_parallel_for_each(p_list* list, ptr_visit func, void* ctx, pl_pool* pool);
+
+/**
+ * @brief Counts the elements of the list that pass a test, on the threads of a pool.
+ * @param list A positional list.
+ * @param pred A pointer to the function that tests each element.
+ * @param ctx A pointer to caller supplied state passed to every call of pred.
+ * @param pool A pool, or null to scan on the calling thread.
+ * @return the number of elements that pass the test.
+ */
+uint pl_parallel_count_if(p_list* list, ptr_predicate pred, void* ctx, pl_pool* pool);
+
+/**
+ * @brief Finds a position whose element passes a test, on the threads of a pool. All the
+ * threads stop as soon as one of them finds such an element, so the position returned is
+ * not necessarily the first in the list.
+ * @param list A positional list.
+ * @param pred A pointer to the function that tests each element.
+ * @param ctx A pointer to caller supplied state passed to every call of pred.
+ * @param pool A pool, or null to scan on the calling thread.
+ * @return a position whose element passes the test, or null if there is none.
+ */
+pl_pos* pl_parallel_find_any(p_list* list, ptr_predicate pred, void* ctx, pl_pool* pool);
+
+////////////////////// END OF PARALLEL FUNCTIONS //////////////////////
+
+#endif
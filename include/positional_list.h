@@ -9,7 +9,9 @@
  * ADT implemented with a doubly linked list is O(n) and the space complexity (usage) is O(n).
  * 
  * 
- * @note This file only contains the interfaces, no implementation.
+ * @note This file only contains the interfaces, no implementation, with the exception of
+ * the cursor functions which are defined "static inline" so that traversal loops can be
+ * inlined by the compiler.
  * 
  * @authors Pheello James Mokoena
  * @date 17 June 2025
@@ -20,6 +22,9 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include "handle_table.h"
+#include "side_table.h"
+#include "rank_index.h"
 
 
 ////////////////////// AUXILLIARY STRUCTURES //////////////////////
@@ -87,6 +92,56 @@ typedef struct p_list{
     /// @brief Stores the number of elements in the list.
     uint num_elements;
 
+    /**
+     * @brief A contiguous block of positions created by "pl_compact", or null.
+     * @note Positions inside the arena are not freed individually; the arena is freed
+     * once its last position is deleted.
+     */
+    pl_pos* arena;
+
+    /// @brief The number of positions the arena was created with.
+    uint arena_len;
+
+    /// @brief The number of positions in the arena that have not been deleted.
+    uint arena_live;
+
+    /**
+     * @brief The table that resolves handles to the positions of this list, or null if
+     * "pl_enable_handles" was not called.
+     */
+    h_table* handles;
+
+    /**
+     * @brief The handles and rank ids of the positions, kept outside of the positions so that
+     * lists without handles or a rank index do not pay for them, or null if neither is
+     * enabled.
+     */
+    s_table* side;
+
+    /**
+     * @brief The index that finds the position at an index, and the index of a position,
+     * in O(log n) time, or null if "pl_enable_rank" was not called.
+     */
+    r_index* rank;
+
+    /**
+     * @brief Incremented by every change to the order or the set of positions, so that data
+     * derived from the layout of the list, such as split points, can tell it is stale.
+     */
+    unsigned long version;
+
+    /**
+     * @brief The first position of each of the ranges the parallel algorithms split the
+     * list into, followed by the trailer, or null if the list was never split.
+     */
+    pl_pos** splits;
+
+    /// @brief The number of ranges described by "splits".
+    uint num_splits;
+
+    /// @brief The version of the list when "splits" was recorded.
+    unsigned long splits_version;
+
 } p_list;
 
 ////////////////////// END OF POSITIONAL LIST STRUCTURE //////////////////////
@@ -136,6 +191,24 @@ typedef pl_pos* (*ptr_search)(void* elem_ptr, p_list* list);
  */
 typedef void (*ptr_print)(p_list* list);
 
+/**
+ * @brief Stores a reference to a function that is applied to each element visited
+ * during a traversal of a positional list.
+ * @param elem_ptr A pointer to the element stored in the visited position.
+ * @param ctx A pointer to caller supplied state, passed through unchanged.
+ */
+typedef void (*ptr_visit)(void* elem_ptr, void* ctx);
+
+/**
+ * @brief Stores a reference to a function that is notified when a position is relocated,
+ * so that holders of the old position can replace it with the new one.
+ * @param old_pos The address the position had before it was relocated. It must not be
+ * dereferenced by the function.
+ * @param new_pos The address of the relocated position.
+ * @param ctx A pointer to caller supplied state, passed through unchanged.
+ */
+typedef void (*ptr_remap)(pl_pos* old_pos, pl_pos* new_pos, void* ctx);
+
 ////////////////////// END OF FUNCTION POINTERS //////////////////////
 
 
@@ -154,6 +227,19 @@ p_list* init_p_list();
  */
 p_list* destroy_p_list(p_list* list);
 
+/**
+ * @brief Deallocates a positional list a part at a time, so that dropping a huge list can be
+ * spread over many short calls instead of one long pause. Each call frees at most
+ * "max_nodes" positions from the front, and the call that frees the last position also
+ * deallocates the list itself. The elements are not deallocated.
+ * @param list A positional list that is no longer used for anything else; once the first
+ * step is taken, only further steps may be applied to it.
+ * @param max_nodes The most positions to free in this call; 0 is taken as 1.
+ * @return true if the list was deallocated completely, false if more steps are needed.
+ * The handles of the freed positions are released, so they no longer resolve.
+ */
+BOOL pl_destroy_step(p_list* list, uint max_nodes);
+
 /**
  * @brief Checks if the position is the header sentinel of the list.
  * @param pos The position to be checked.
@@ -266,6 +352,24 @@ pl_pos* add_before(pl_pos* pos,void* elem_ptr,p_list* list);
  */
 pl_pos* add_after(pl_pos* pos, void* elem_ptr, p_list* list);
 
+/**
+ * @brief Moves the position pos to the front of the list by relinking it, so that no
+ * position is deallocated or allocated and pos stays valid.
+ * @param pos A pointer to the position to be moved.
+ * @param list A positional list containing this position.
+ * @return the position that was moved, or null if pos is a sentinel.
+ */
+pl_pos* pl_move_first(pl_pos* pos, p_list* list);
+
+/**
+ * @brief Moves the position pos to the back of the list by relinking it, so that no
+ * position is deallocated or allocated and pos stays valid.
+ * @param pos A pointer to the position to be moved.
+ * @param list A positional list containing this position.
+ * @return the position that was moved, or null if pos is a sentinel.
+ */
+pl_pos* pl_move_last(pl_pos* pos, p_list* list);
+
 /**
  * @brief Replaces the element at position pos with element e.
  * @param pos A pointer to the position whose element is to be replaced.
@@ -302,9 +406,412 @@ void* pl_search(void* elem_ptr, p_list* list, ptr_search func);
  */
 void print_p_list(p_list* list, ptr_print func);
 
+/**
+ * @brief Applies a function to every element of the list, from the first to the last
+ * position. Upcoming positions are prefetched while the current one is being visited.
+ * @param list A positional list to be traversed.
+ * @param func A pointer to a function applied to each element.
+ * @param ctx A pointer to caller supplied state passed to every call of func.
+ */
+void pl_for_each(p_list* list, ptr_visit func, void* ctx);
+
+/**
+ * @brief Applies a function to every element of the list, from the last to the first
+ * position. Upcoming positions are prefetched while the current one is being visited.
+ * @param list A positional list to be traversed.
+ * @param func A pointer to a function applied to each element.
+ * @param ctx A pointer to caller supplied state passed to every call of func.
+ */
+void pl_for_each_reverse(p_list* list, ptr_visit func, void* ctx);
+
+/**
+ * @brief Relocates all the positions of the list into one contiguous block of memory,
+ * in list order, and updates all the links. Lists that have gone through a lot of
+ * insertions and deletions have their positions scattered across the heap; after
+ * compaction a traversal reads memory sequentially again. Runs in O(n).
+ * @param list A positional list to be compacted.
+ * @param func A pointer to a function that is called with the old and new address of
+ * every relocated position, or null. All positions previously obtained from the list are
+ * invalid after compaction, the header and trailer excepted.
+ * @param ctx A pointer to caller supplied state passed to every call of func.
+ * @return true if the list was compacted, false if memory could not be allocated, in
+ * which case the list is left unchanged.
+ * @note Handles issued by the list remain valid, they are updated to the new addresses.
+ */
+BOOL pl_compact(p_list* list, ptr_remap func, void* ctx);
+
 ////////////////////// END OF POSITIONAL LIST FUNCTIONS //////////////////////
 
 
+////////////////////// HANDLE FUNCTIONS //////////////////////
+
+/**
+ * @brief Enables handle-based positions for this list. A handle is a 32-bit index and
+ * generation pair that refers to a position through the list's handle table. Using a
+ * handle after its position was deleted is detected and rejected in O(1), and handles
+ * stay valid when "pl_compact" relocates the positions.
+ * @param list A positional list.
+ * @return true if handles are enabled.
+ * @note Deleting a position, with "delete" or "pl_h_delete", makes its handle stale.
+ */
+BOOL pl_enable_handles(p_list* list);
+
+/**
+ * @brief Returns the handle of a position, issuing one if the position has none yet.
+ * @param pos A position of the list.
+ * @param list A positional list with handles enabled.
+ * @return the handle of the position, or H_NULL if it could not be issued.
+ */
+h_handle pl_get_handle(pl_pos* pos, p_list* list);
+
+/**
+ * @brief Returns the position a handle refers to.
+ * @param handle A handle issued by this list.
+ * @param list A positional list with handles enabled.
+ * @return the position, or null if the handle is stale.
+ */
+pl_pos* pl_h_resolve(h_handle handle, p_list* list);
+
+/**
+ * @brief Inserts a new element at the front of the list.
+ * @param elem_ptr A pointer to the element to be inserted.
+ * @param list A positional list with handles enabled.
+ * @return the handle of the new position, or H_NULL if it could not be added.
+ */
+h_handle pl_h_add_first(void* elem_ptr, p_list* list);
+
+/**
+ * @brief Inserts a new element at the back of the list.
+ * @param elem_ptr A pointer to the element to be inserted.
+ * @param list A positional list with handles enabled.
+ * @return the handle of the new position, or H_NULL if it could not be added.
+ */
+h_handle pl_h_add_last(void* elem_ptr, p_list* list);
+
+/**
+ * @brief Inserts a new element just before the position the handle refers to.
+ * @param handle The handle of the position to insert before.
+ * @param elem_ptr A pointer to the element to be inserted.
+ * @param list A positional list with handles enabled.
+ * @return the handle of the new position, or H_NULL if the handle is stale.
+ */
+h_handle pl_h_add_before(h_handle handle, void* elem_ptr, p_list* list);
+
+/**
+ * @brief Inserts a new element just after the position the handle refers to.
+ * @param handle The handle of the position to insert after.
+ * @param elem_ptr A pointer to the element to be inserted.
+ * @param list A positional list with handles enabled.
+ * @return the handle of the new position, or H_NULL if the handle is stale.
+ */
+h_handle pl_h_add_after(h_handle handle, void* elem_ptr, p_list* list);
+
+/**
+ * @brief Removes and returns the element at the position the handle refers to, making
+ * the handle stale.
+ * @param handle The handle of the position to be removed.
+ * @param list A positional list with handles enabled.
+ * @return the element stored in the position, or null if the handle is stale.
+ */
+void* pl_h_delete(h_handle handle, p_list* list);
+
+////////////////////// END OF HANDLE FUNCTIONS //////////////////////
+
+
+////////////////////// CURSOR //////////////////////
+
+/**
+ * @brief The number of positions the cursor runs ahead of the current position, issuing
+ * a prefetch for each, so that long traversals overlap the memory latency of the next
+ * nodes instead of stalling on every "next_ptr".
+ */
+#ifndef PL_PREFETCH_DISTANCE
+#define PL_PREFETCH_DISTANCE 4
+#endif
+
+/**
+ * @brief Hints the processor to start loading the memory at addr into the cache.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define PL_PREFETCH(addr) __builtin_prefetch((addr), 0, 3)
+#else
+#define PL_PREFETCH(addr) ((void)(addr))
+#endif
+
+/**
+ * @brief A lightweight cursor over the positions of a positional list. Unlike "after" and
+ * "before", stepping the cursor performs no sentinel or null checks beyond comparing with
+ * the sentinel it stops at, and it keeps a look-ahead pointer PL_PREFETCH_DISTANCE
+ * positions in front of the current one which it prefetches.
+ * @note The list must not be modified while a cursor is in use, except through
+ * "set".
+ */
+typedef struct pl_cursor{
+
+    /// @brief The position the cursor currently refers to.
+    pl_pos* curr;
+
+    /// @brief The prefetched position PL_PREFETCH_DISTANCE steps in front of curr.
+    pl_pos* ahead;
+
+    /// @brief The sentinel at which the traversal stops.
+    pl_pos* end;
+
+    /// @brief TRUE if the cursor moves from the trailer towards the header.
+    BOOL reverse;
+
+} pl_cursor;
+
+/**
+ * @brief Moves a position one step in the direction of the cursor.
+ */
+static inline pl_pos* pl_cursor_step(pl_pos* pos, BOOL reverse){
+    return reverse == TRUE ? pos->prev_ptr : pos->next_ptr;
+}
+
+/**
+ * @brief Creates a cursor that starts at the position curr and moves in the given direction.
+ * @param curr The first position the cursor refers to.
+ * @param end The sentinel at which the traversal stops.
+ * @param reverse TRUE to move towards the header, FALSE to move towards the trailer.
+ * @return the cursor.
+ */
+static inline pl_cursor pl_cursor_at(pl_pos* curr, pl_pos* end, BOOL reverse){
+
+    pl_cursor cur = {curr, curr, end, reverse};
+
+    // run the look-ahead pointer out in front of the current position.
+    for(int i=0; i<PL_PREFETCH_DISTANCE && cur.ahead != NULL && cur.ahead != end; ++i){
+        cur.ahead = pl_cursor_step(cur.ahead, reverse);
+        PL_PREFETCH(cur.ahead);
+    }
+
+    return cur;
+}
+
+/**
+ * @brief Creates a cursor that refers to the first position and moves forward.
+ * @param list A positional list.
+ * @return a cursor over the list, which is not valid if the list is empty.
+ */
+static inline pl_cursor pl_cursor_begin(p_list* list){
+
+    if(list == NULL)
+        return pl_cursor_at(NULL, NULL, FALSE);
+
+    return pl_cursor_at(list->header->next_ptr, list->trailer, FALSE);
+}
+
+/**
+ * @brief Creates a cursor that refers to the last position and moves backward.
+ * @param list A positional list.
+ * @return a cursor over the list, which is not valid if the list is empty.
+ */
+static inline pl_cursor pl_cursor_rbegin(p_list* list){
+
+    if(list == NULL)
+        return pl_cursor_at(NULL, NULL, TRUE);
+
+    return pl_cursor_at(list->trailer->prev_ptr, list->header, TRUE);
+}
+
+/**
+ * @brief Checks if the cursor refers to a position storing an element.
+ * @param cur A pointer to a cursor.
+ * @return true if the cursor has not yet reached the end of the list.
+ */
+static inline BOOL pl_cursor_valid(pl_cursor* cur){
+    return cur->curr != cur->end ? TRUE : FALSE;
+}
+
+/**
+ * @brief Moves the cursor one position in its direction and prefetches the position
+ * PL_PREFETCH_DISTANCE steps further on.
+ * @param cur A pointer to a valid cursor.
+ */
+static inline void pl_cursor_next(pl_cursor* cur){
+
+    cur->curr = pl_cursor_step(cur->curr, cur->reverse);
+
+    if(cur->ahead != cur->end){
+        cur->ahead = pl_cursor_step(cur->ahead, cur->reverse);
+        PL_PREFETCH(cur->ahead);
+    }
+}
+
+/**
+ * @brief Returns the position the cursor refers to.
+ * @param cur A pointer to a valid cursor.
+ * @return the current position.
+ */
+static inline pl_pos* pl_cursor_pos(pl_cursor* cur){
+    return cur->curr;
+}
+
+/**
+ * @brief Returns the element stored at the position the cursor refers to.
+ * @param cur A pointer to a valid cursor.
+ * @return a pointer to the current element.
+ */
+static inline void* pl_cursor_get(pl_cursor* cur){
+    return cur->curr->data_ptr;
+}
+
+////////////////////// END OF CURSOR //////////////////////
+
+
+////////////////////// RANK FUNCTIONS //////////////////////
+
+/**
+ * @brief Enables index-based access for this list. From then on every insertion, deletion
+ * and move also updates a rank index kept alongside the list, in expected O(log n) time, so
+ * that "pl_at" and "pl_index_of" run in expected O(log n) time instead of O(n).
+ * @param list A positional list.
+ * @return true if index-based access is enabled.
+ * @note If memory for the rank index runs out during an insertion, the rank index is
+ * dropped and the functions below fall back to walking the list.
+ */
+BOOL pl_enable_rank(p_list* list);
+
+/**
+ * @brief Returns the position at an index of the list, counting from 0.
+ * @param list A positional list.
+ * @param k The index of the position.
+ * @return the position, or null if k is out of range.
+ */
+pl_pos* pl_at(p_list* list, uint k);
+
+/**
+ * @brief Returns the index of a position in the list, counting from 0.
+ * @param pos A position of the list.
+ * @param list A positional list.
+ * @return the index of the position, or -1 if pos is null or a sentinel.
+ */
+long pl_index_of(pl_pos* pos, p_list* list);
+
+////////////////////// END OF RANK FUNCTIONS //////////////////////
+
+
+////////////////////// GENERATOR //////////////////////
+
+/**
+ * @brief A resumable forward traversal of a positional list, for scanning a list in pages.
+ * Producing a page of k elements costs O(k), and a suspended generator can be saved as a
+ * handle and resumed from it in O(1).
+ * @note Between pages the list may be modified, except that the position the generator
+ * will produce next must not be deleted unless the generator was saved with
+ * "pl_gen_save"; a saved generator detects that deletion when resumed.
+ */
+typedef struct pl_gen{
+
+    /// @brief The position whose element is produced next, or the trailer when done.
+    pl_pos* next;
+
+} pl_gen;
+
+/**
+ * @brief Returns a generator positioned at the first element of the list.
+ * @param list A positional list.
+ * @return the generator.
+ */
+pl_gen pl_gen_begin(p_list* list);
+
+/**
+ * @brief Produces the next elements of a generator.
+ * @param gen A generator over the list.
+ * @param list A positional list.
+ * @param out An array that receives up to n elements.
+ * @param n The maximum number of elements to produce.
+ * @return the number of elements produced, less than n only when the list is exhausted.
+ */
+uint pl_gen_next_n(pl_gen* gen, p_list* list, void** out, uint n);
+
+/**
+ * @brief Tells whether a generator has produced every element of its list.
+ * @param gen A generator over the list.
+ * @param list A positional list.
+ * @return true if the generator is exhausted.
+ */
+BOOL pl_gen_done(pl_gen* gen, p_list* list);
+
+/**
+ * @brief Saves a generator as the handle of the position it produces next, which can be
+ * stored by the caller, for example in a pagination token.
+ * @param gen A generator over the list.
+ * @param list A positional list with handles enabled.
+ * @param token Receives the handle, or H_NULL if the generator is exhausted.
+ * @return true if the generator was saved.
+ */
+BOOL pl_gen_save(pl_gen* gen, p_list* list, h_handle* token);
+
+/**
+ * @brief Restores a generator saved with "pl_gen_save".
+ * @param gen Receives the generator.
+ * @param token The saved handle.
+ * @param list The positional list the generator was saved from.
+ * @return true if the generator was restored, false if the position it would produce next
+ * has since been deleted.
+ */
+BOOL pl_gen_resume(pl_gen* gen, h_handle token, p_list* list);
+
+////////////////////// END OF GENERATOR //////////////////////
+
+
+////////////////////// MEMORY FUNCTIONS //////////////////////
+
+/**
+ * @brief A breakdown of the memory held by a positional list, in bytes. The elements the
+ * positions point to belong to the caller and are not counted.
+ */
+typedef struct pl_mem_usage{
+
+    /// @brief The element pointers stored in the positions.
+    size_t payload_bytes;
+
+    /// @brief The rest of the positions: their links.
+    size_t node_overhead_bytes;
+
+    /// @brief The header and trailer sentinels.
+    size_t sentinel_bytes;
+
+    /// @brief The handle table.
+    size_t handle_bytes;
+
+    /// @brief The rank index.
+    size_t rank_bytes;
+
+    /// @brief The side table of the positions' handles and rank ids.
+    size_t side_bytes;
+
+    /// @brief The list structure and the split points cached by the parallel algorithms.
+    size_t list_bytes;
+
+    /**
+     * @brief The positions of the block made by "pl_compact" that were deleted since. They
+     * stay allocated until the block's last position is deleted or the list is compacted
+     * again.
+     */
+    size_t dead_arena_bytes;
+
+    /// @brief The number of separate heap allocations, a measure of fragmentation.
+    uint num_allocations;
+
+    /// @brief The sum of all the byte counts above.
+    size_t total_bytes;
+
+} pl_mem_usage;
+
+/**
+ * @brief Reports the memory held by a positional list in O(1) time.
+ * @param list A positional list.
+ * @param usage Receives the breakdown.
+ * @return true if the breakdown was filled in.
+ */
+BOOL pl_memory_usage(p_list* list, pl_mem_usage* usage);
+
+////////////////////// END OF MEMORY FUNCTIONS //////////////////////
+
+
 ////////////////////// SEARCH FUNCTIONS //////////////////////
 
 /**
@@ -0,0 +1,195 @@
+/**
+ * @brief This priority_queue.h file contains the data structures and functions that
+ * implement the Adaptable Priority Queue ADT with an array-based d-ary heap. The position
+ * struct of the queue is named "pq_pos", which stands for "Priority Queue Position", and,
+ * like the "pl_pos" of a positional list, it stays valid for as long as its entry is in the
+ * queue, so that the key of an entry can be changed or the entry removed through it.
+ * The heap array stores each entry's key next to a pointer to its position, so that the
+ * comparisons made while sifting only read the array. The heap is binary by default and can
+ * be made 4-ary, which halves its height and keeps all the children of a node in one cache
+ * line.
+ * Insertion, removal of the minimum, and key changes and removals through a position run in
+ * O(log n) time; accessing the minimum runs in O(1).
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_PRIORITY_QUEUE_H
+#define _DSA_PRIORITY_QUEUE_H
+
+#include <stdlib.h>
+#include "positional_list.h"
+
+/// @brief The number of entries a priority queue has room for when it is created.
+#define PQ_DEFAULT_CAPACITY 16
+
+
+////////////////////// POSITION STRUCTURE //////////////////////
+
+/**
+ * @brief The key type by which entries are ordered, smallest first.
+ */
+typedef long pq_key;
+
+/**
+ * @brief A position of a priority queue. It stores a reference to the element of an entry
+ * and the index of the entry in the heap array, which is kept up to date as the entry moves.
+ */
+typedef struct pq_pos{
+
+    /// @brief A pointer to the element stored in the entry.
+    void* data_ptr;
+
+    /// @brief The key of the entry.
+    pq_key key;
+
+    /// @brief The index of the entry in the heap array.
+    uint index;
+
+} pq_pos;
+
+/**
+ * @brief An entry of the heap array.
+ */
+typedef struct pq_entry{
+
+    /// @brief A copy of the key of the entry, so that sifting does not follow "pos".
+    pq_key key;
+
+    /// @brief The position of the entry.
+    pq_pos* pos;
+
+} pq_entry;
+
+////////////////////// END OF POSITION STRUCTURE //////////////////////
+
+
+////////////////////// PRIORITY QUEUE STRUCTURE //////////////////////
+
+/**
+ * @brief An adaptable priority queue implemented with an array-based d-ary min-heap.
+ */
+typedef struct p_queue{
+
+    /// @brief The heap array of entries.
+    pq_entry* heap;
+
+    /// @brief The number of entries in the queue.
+    uint num_elements;
+
+    /// @brief The number of entries the heap array has room for.
+    uint capacity;
+
+    /// @brief The number of children of each heap node, either 2 or 4.
+    uint arity;
+
+} p_queue;
+
+////////////////////// END OF PRIORITY QUEUE STRUCTURE //////////////////////
+
+
+////////////////////// POSITION FUNCTIONS //////////////////////
+
+/**
+ * @brief Returns a pointer to the element stored at this position.
+ * @param pos A priority queue position.
+ * @return a pointer to the element stored in this position.
+ */
+void* get_pq_element(pq_pos* pos);
+
+/**
+ * @brief Returns the key of the entry stored at this position.
+ * @param pos A priority queue position.
+ * @return the key of the entry.
+ */
+pq_key get_pq_key(pq_pos* pos);
+
+////////////////////// END OF POSITION FUNCTIONS //////////////////////
+
+
+////////////////////// PRIORITY QUEUE FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates and initializes a priority queue.
+ * @param arity The number of children of each heap node, 2 for a binary heap or 4 for a
+ * 4-ary heap. Any other value results in a binary heap.
+ * @return the address of the newly created priority queue.
+ */
+p_queue* init_pq(uint arity);
+
+/**
+ * @brief Deallocates the memory that was allocated to this priority queue and its
+ * positions. The elements are not deallocated.
+ * @param pq A priority queue.
+ * @return a null value indicating that the queue is successfully deleted.
+ */
+p_queue* destroy_pq(p_queue* pq);
+
+/**
+ * @brief Returns true if the priority queue does not contain any entries.
+ * @param pq A priority queue.
+ * @return true if the queue is empty, otherwise false.
+ */
+BOOL is_pq_empty(p_queue* pq);
+
+/**
+ * @brief Returns the number of entries in the priority queue.
+ * @param pq A priority queue.
+ * @return the number of entries in the priority queue.
+ */
+uint pq_size(p_queue* pq);
+
+/**
+ * @brief Inserts an entry with the given key and element. Runs in O(log n).
+ * @param key The key of the entry.
+ * @param elem_ptr A pointer to the element of the entry.
+ * @param pq A priority queue.
+ * @return the position of the new entry, or null if memory could not be allocated.
+ */
+pq_pos* pq_insert(pq_key key, void* elem_ptr, p_queue* pq);
+
+/**
+ * @brief Returns the position of an entry with the smallest key, without removing it.
+ * @param pq A priority queue.
+ * @return the position with the smallest key, or null if the queue is empty.
+ */
+pq_pos* pq_min(p_queue* pq);
+
+/**
+ * @brief Removes an entry with the smallest key, invalidating its position. Runs in O(log n).
+ * @param pq A priority queue.
+ * @return the element of the removed entry, or null if the queue is empty.
+ */
+void* pq_remove_min(p_queue* pq);
+
+/**
+ * @brief Lowers the key of the entry at this position. Runs in O(log n).
+ * @param pos The position of the entry.
+ * @param key The new key, which must not be greater than the current key.
+ * @param pq A priority queue containing this position.
+ * @return true if the key was decreased, false if the new key is greater.
+ */
+BOOL pq_decrease_key(pq_pos* pos, pq_key key, p_queue* pq);
+
+/**
+ * @brief Replaces the key of the entry at this position, in either direction. Runs in O(log n).
+ * @param pos The position of the entry.
+ * @param key The new key.
+ * @param pq A priority queue containing this position.
+ */
+void pq_replace_key(pq_pos* pos, pq_key key, p_queue* pq);
+
+/**
+ * @brief Removes the entry at this position, invalidating the position. Runs in O(log n).
+ * @param pos The position of the entry to be removed.
+ * @param pq A priority queue containing this position.
+ * @return the element of the removed entry.
+ */
+void* pq_remove(pq_pos* pos, p_queue* pq);
+
+////////////////////// END OF PRIORITY QUEUE FUNCTIONS //////////////////////
+
+#endif // _DSA_PRIORITY_QUEUE_H
@@ -0,0 +1,149 @@
+/**
+ * @brief This rank_index.h file contains the structures and interfaces for a rank index: a
+ * sequence of items, kept alongside a linked container, that answers "which item is at
+ * index k" (select) and "at which index is this item" (rank) in expected O(log n) time.
+ * It is an implicit treap: a binary tree in which the in-order sequence of the nodes is the
+ * sequence of items, every node counts the nodes in its subtree, and random priorities keep
+ * the tree balanced in expectation. Nodes have parent links, so an item is inserted next to
+ * another, or removed, without searching for it.
+ *
+ * Nodes are referred to by 32-bit ids that stay valid until the node is removed, so a
+ * container can store the id of its node in each of its own positions.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_RANK_INDEX_H
+#define _DSA_RANK_INDEX_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/// @brief The id that refers to no node.
+#define R_NIL 0u
+
+/// @brief The number of nodes a rank index has room for when it is created.
+#define R_DEFAULT_CAPACITY 64
+
+/**
+ * @brief A node of a rank index.
+ */
+typedef struct r_node{
+
+    /// @brief The item stored in the node, or null if the node is free.
+    void* item;
+
+    /// @brief The ids of the left and right children and the parent, R_NIL if absent.
+    uint32_t left, right, parent;
+
+    /// @brief The number of nodes in the subtree rooted at this node.
+    uint32_t size;
+
+    /// @brief The heap priority of the node; a parent's priority is never below its children's.
+    uint32_t priority;
+
+} r_node;
+
+/**
+ * @brief A rank index. Node 0 is never used, so that R_NIL never refers to a node.
+ */
+typedef struct r_index{
+
+    /// @brief The array of nodes, indexed by id.
+    r_node* nodes;
+
+    /// @brief The number of nodes the array has room for.
+    uint32_t capacity;
+
+    /// @brief The number of ids that were ever used, including id 0.
+    uint32_t num_used;
+
+    /// @brief The id of the root node, or R_NIL if the index is empty.
+    uint32_t root;
+
+    /// @brief The id of the first free node, linked through the "parent" field.
+    uint32_t free_head;
+
+    /// @brief The state of the generator that draws the priorities.
+    uint32_t rng;
+
+} r_index;
+
+
+/**
+ * @brief Creates an empty rank index.
+ * @return a pointer to the rank index, or null if memory could not be allocated.
+ */
+r_index* init_r_index();
+
+/**
+ * @brief Deallocates a rank index. The items are not deallocated.
+ * @param index A rank index.
+ * @return null.
+ */
+r_index* destroy_r_index(r_index* index);
+
+/**
+ * @brief Returns the number of items in the index.
+ * @param index A rank index.
+ * @return the number of items.
+ */
+uint32_t ri_size(r_index* index);
+
+/**
+ * @brief Inserts an item right after the item of a node, or at the front.
+ * @param index A rank index.
+ * @param after The id of the node the item goes after, or R_NIL to insert at the front.
+ * @param item The item, not null.
+ * @return the id of the new node, or R_NIL if memory could not be allocated.
+ */
+uint32_t ri_insert_after(r_index* index, uint32_t after, void* item);
+
+/**
+ * @brief Removes a node from the index, freeing its id.
+ * @param index A rank index.
+ * @param id The id of the node.
+ */
+void ri_remove(r_index* index, uint32_t id);
+
+/**
+ * @brief Returns the index of a node's item in the sequence, counting from 0.
+ * @param index A rank index.
+ * @param id The id of the node.
+ * @return the rank of the node.
+ */
+uint32_t ri_rank(r_index* index, uint32_t id);
+
+/**
+ * @brief Returns the node whose item is at index k in the sequence.
+ * @param index A rank index.
+ * @param k An index less than the number of items.
+ * @return the id of the node, or R_NIL if k is out of range.
+ */
+uint32_t ri_select(r_index* index, uint32_t k);
+
+/**
+ * @brief Returns the item of a node.
+ * @param index A rank index.
+ * @param id The id of the node.
+ * @return the item.
+ */
+static inline void* ri_item(r_index* index, uint32_t id){
+    return index->nodes[id].item;
+}
+
+/**
+ * @brief Replaces the item of a node, for example when the position it stands for moved.
+ * @param index A rank index.
+ * @param id The id of the node.
+ * @param item The new item.
+ */
+static inline void ri_set_item(r_index* index, uint32_t id, void* item){
+    index->nodes[id].item = item;
+}
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * @brief This reclaimer.h file contains the data structures and functions of a background
+ * reclaimer: a thread that takes ownership of positional lists and general trees that are
+ * no longer used, and deallocates them with "pl_destroy_step" and "gt_destroy_step" a
+ * batch of RC_STEP_NODES positions at a time, yielding the processor between batches.
+ * Handing a structure over returns at once, so the thread that drops a huge container does
+ * not pause for as long as freeing its positions takes.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_RECLAIMER_H
+#define _DSA_RECLAIMER_H
+
+#include <stdlib.h>
+#include <pthread.h>
+#include "positional_list.h"
+#include "deque.h"
+#include "general_tree.h"
+
+/// @brief The number of positions the reclaimer frees before it yields the processor.
+#define RC_STEP_NODES 4096
+
+
+////////////////////// RECLAIMER STRUCTURE //////////////////////
+
+/**
+ * @brief A background reclaimer.
+ */
+typedef struct reclaimer{
+
+    /// @brief The reclaiming thread.
+    pthread_t thread;
+
+    /// @brief Protects the fields below.
+    pthread_mutex_t lock;
+
+    /// @brief Signals the thread that a structure was handed over or that it should stop.
+    pthread_cond_t work_posted;
+
+    /// @brief Signals the waiting threads that the queues are empty and nothing is being freed.
+    pthread_cond_t work_done;
+
+    /// @brief The positional lists and general trees waiting to be deallocated.
+    a_queue* lists;
+    a_queue* trees;
+
+    /// @brief The number of structures handed over and not yet completely deallocated.
+    uint pending;
+
+    /// @brief Set when the reclaimer is being destroyed.
+    BOOL stop;
+
+} reclaimer;
+
+////////////////////// END OF RECLAIMER STRUCTURE //////////////////////
+
+
+////////////////////// RECLAIMER FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates a reclaimer and starts its thread.
+ * @return a pointer to the reclaimer, or null if it could not be created.
+ */
+reclaimer* init_reclaimer();
+
+/**
+ * @brief Waits until every structure handed over is deallocated, then stops the thread and
+ * deallocates the reclaimer.
+ * @param rc A reclaimer.
+ * @return null.
+ */
+reclaimer* destroy_reclaimer(reclaimer* rc);
+
+/**
+ * @brief Hands a positional list over to the reclaimer, which deallocates it in the
+ * background. The elements are not deallocated.
+ * @param rc A reclaimer.
+ * @param list A positional list that nothing else refers to any more.
+ * @return true if the reclaimer took the list, false if memory could not be allocated, in
+ * which case the caller still owns the list.
+ */
+BOOL rc_retire_p_list(reclaimer* rc, p_list* list);
+
+/**
+ * @brief Hands a general tree over to the reclaimer, which deallocates it in the
+ * background. The data stored in the positions is not deallocated.
+ * @param rc A reclaimer.
+ * @param tree A general tree that nothing else refers to any more.
+ * @return true if the reclaimer took the tree, false if memory could not be allocated, in
+ * which case the caller still owns the tree.
+ */
+BOOL rc_retire_g_tree(reclaimer* rc, g_tree* tree);
+
+/**
+ * @brief Returns the number of structures handed over and not yet completely deallocated.
+ * @param rc A reclaimer.
+ * @return the number of structures.
+ */
+uint rc_pending(reclaimer* rc);
+
+/**
+ * @brief Waits until every structure handed over so far is deallocated.
+ * @param rc A reclaimer.
+ */
+void rc_drain(reclaimer* rc);
+
+////////////////////// END OF RECLAIMER FUNCTIONS //////////////////////
+
+#endif
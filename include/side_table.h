@@ -0,0 +1,117 @@
+/**
+ * @brief This side_table.h file contains the structures and interfaces for a side table: a
+ * hash table, keyed by the address of a position, that holds the optional data of the
+ * positions of a container, such as their handles and rank ids, outside of the positions.
+ * A container whose optional features are off keeps no table at all, so its positions stay
+ * as small as the links and data they always need, and one whose features are on pays for
+ * the table instead.
+ *
+ * It uses open addressing with linear probing, and removals shift the entries that follow
+ * back, so no slot is ever left marked as deleted.
+ *
+ * @note All the functions run in expected O(1) time, amortized for "st_insert".
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_SIDE_TABLE_H
+#define _DSA_SIDE_TABLE_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "handle_table.h"
+#include "rank_index.h"
+
+/// @brief The number of slots a table starts with, a power of two.
+#define ST_DEFAULT_CAPACITY 64
+
+/**
+ * @brief The data a side table holds for one position.
+ */
+typedef struct st_entry{
+
+    /// @brief The address of the position, or null if the slot is empty.
+    const void* pos;
+
+    /// @brief The handle issued for the position, or H_NULL if it has none.
+    h_handle handle;
+
+    /// @brief The id of the position's node in a rank index, or R_NIL if it has none.
+    uint32_t rank_id;
+
+} st_entry;
+
+/**
+ * @brief A hash table of entries keyed by the address of their position.
+ */
+typedef struct s_table{
+
+    /// @brief The slots of the table.
+    st_entry* slots;
+
+    /// @brief The number of slots, always a power of two.
+    uint32_t capacity;
+
+    /// @brief The number of slots that hold an entry.
+    uint32_t count;
+
+} s_table;
+
+/**
+ * @brief Creates and initializes an empty side table.
+ * @return a pointer to the newly created table, or null if allocation failed.
+ */
+s_table* init_s_table();
+
+/**
+ * @brief Deallocates the memory allocated to the side table. The positions are not
+ * deallocated.
+ * @param table A side table.
+ * @return a null value indicating that the table is successfully deleted.
+ */
+s_table* destroy_s_table(s_table* table);
+
+/**
+ * @brief Returns the entry of a position.
+ * @param table A side table, or null.
+ * @param pos The address of a position.
+ * @return a pointer to the entry, or null if the position has none. The pointer is only
+ * valid until the next entry is inserted or removed.
+ */
+st_entry* st_find(s_table* table, const void* pos);
+
+/**
+ * @brief Returns the entry of a position, adding an empty one if the position has none.
+ * @param table A side table.
+ * @param pos The address of a position, must not be null.
+ * @return a pointer to the entry, or null if the table could not grow. The pointer is only
+ * valid until the next entry is inserted or removed.
+ */
+st_entry* st_insert(s_table* table, const void* pos);
+
+/**
+ * @brief Removes the entry of a position.
+ * @param table A side table, or null.
+ * @param pos The address of a position.
+ * @return true if the position had an entry.
+ */
+bool st_remove(s_table* table, const void* pos);
+
+/**
+ * @brief Moves the entry of a position that was copied to a new address. It never needs to
+ * grow the table, so it cannot fail.
+ * @param table A side table, or null.
+ * @param old_pos The old address of the position.
+ * @param new_pos The new address of the position, which must not have an entry.
+ */
+void st_relocate(s_table* table, const void* old_pos, const void* new_pos);
+
+/**
+ * @brief Returns the number of bytes the table holds, its slots included.
+ */
+size_t st_bytes(s_table* table);
+
+#endif // _DSA_SIDE_TABLE_H
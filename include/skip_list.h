@@ -0,0 +1,216 @@
+/**
+ * @brief This skip_list.h file contains the data structures and functions of an ordered
+ * container in the style of the positional list, implemented with a skip list. The struct
+ * that represents the container is named "s_list" and its positions "sl_pos". Elements are
+ * kept sorted by a user supplied comparator, and every position is linked into a random
+ * number of levels, each level skipping about 3 out of 4 positions of the level below it, so
+ * that insertions, deletions and searches run in expected O(log n) time instead of the O(n)
+ * of walking a sorted positional list.
+ * Positions are allocated once and never move, so a position stays valid, like a "pl_pos",
+ * until its element is deleted. Elements that compare equal are kept in insertion order.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_SKIP_LIST_H
+#define _DSA_SKIP_LIST_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "positional_list.h"
+
+/// @brief The maximum number of levels of a skip list, enough for 4^32 elements.
+#define SL_MAX_LEVEL 32
+
+
+////////////////////// POSITION STRUCTURE //////////////////////
+
+/**
+ * @brief A position of a skip list. Its array of forward links has one entry per level the
+ * position is linked into.
+ */
+typedef struct sl_pos{
+
+    /// @brief A pointer to the data stored in the position.
+    void* data_ptr;
+
+    /// @brief A pointer to the previous position on the bottom level, or null for the first.
+    struct sl_pos* prev_ptr;
+
+    /// @brief The number of levels the position is linked into.
+    uint height;
+
+    /// @brief The next position on each of the position's levels, or null at the end.
+    struct sl_pos* next_ptr[];
+
+} sl_pos;
+
+////////////////////// END OF POSITION STRUCTURE //////////////////////
+
+
+/**
+ * @brief A pointer to a function that orders two elements.
+ * @param elem_a A pointer to the first element.
+ * @param elem_b A pointer to the second element.
+ * @return a negative value, 0 or a positive value if the first element is less than, equal
+ * to or greater than the second.
+ */
+typedef int (*sl_compare)(void* elem_a, void* elem_b);
+
+
+////////////////////// SKIP LIST STRUCTURE //////////////////////
+
+/**
+ * @brief A generic ordered container implemented with a skip list.
+ */
+typedef struct s_list{
+
+    /// @brief A sentinel linked into every level, in front of the first position.
+    /// @note It does not store any data.
+    sl_pos* header;
+
+    /// @brief The last position, or null if the list is empty.
+    sl_pos* tail;
+
+    /// @brief The number of levels currently in use.
+    uint level;
+
+    /// @brief Stores the number of elements in the list.
+    uint num_elements;
+
+    /// @brief The function that orders the elements.
+    sl_compare compare;
+
+    /// @brief The state of the generator that draws the height of new positions.
+    uint64_t rng;
+
+} s_list;
+
+////////////////////// END OF SKIP LIST STRUCTURE //////////////////////
+
+
+////////////////////// SKIP LIST FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates an empty skip list.
+ * @param compare The function that orders the elements.
+ * @return a pointer to the skip list, or null if memory could not be allocated.
+ */
+s_list* init_s_list(sl_compare compare);
+
+/**
+ * @brief Deallocates a skip list and all its positions. The elements are not deallocated.
+ * @param list A skip list.
+ * @return null.
+ */
+s_list* destroy_s_list(s_list* list);
+
+/**
+ * @brief Returns the number of elements in the list.
+ * @param list A skip list.
+ * @return the number of elements.
+ */
+uint sl_size(s_list* list);
+
+/**
+ * @brief Tells whether the list has no elements.
+ * @param list A skip list.
+ * @return true if the list is empty.
+ */
+BOOL sl_is_empty(s_list* list);
+
+/**
+ * @brief Returns the element stored in a position.
+ * @param pos A position of a skip list.
+ * @return a pointer to the element, or null if the position is null.
+ */
+void* sl_get_element(sl_pos* pos);
+
+/**
+ * @brief Returns the position of the smallest element.
+ * @param list A skip list.
+ * @return the first position, or null if the list is empty.
+ */
+sl_pos* sl_first(s_list* list);
+
+/**
+ * @brief Returns the position of the largest element.
+ * @param list A skip list.
+ * @return the last position, or null if the list is empty.
+ */
+sl_pos* sl_last(s_list* list);
+
+/**
+ * @brief Returns the position after a position, in order.
+ * @param pos A position of the list.
+ * @return the next position, or null if pos is the last.
+ */
+sl_pos* sl_after(sl_pos* pos);
+
+/**
+ * @brief Returns the position before a position, in order.
+ * @param pos A position of the list.
+ * @return the previous position, or null if pos is the first.
+ */
+sl_pos* sl_before(sl_pos* pos);
+
+/**
+ * @brief Inserts an element in order, after the elements that compare equal to it, in
+ * expected O(log n) time.
+ * @param elem_ptr A pointer to the element to be inserted.
+ * @param list A skip list.
+ * @return the position of the new element, or null if it could not be added.
+ */
+sl_pos* sl_insert(void* elem_ptr, s_list* list);
+
+/**
+ * @brief Finds the first position whose element compares equal to a key.
+ * @param key A pointer to an element to compare with.
+ * @param list A skip list.
+ * @return the position, or null if no element equals the key.
+ */
+sl_pos* sl_find(void* key, s_list* list);
+
+/**
+ * @brief Finds the first position whose element is not less than a key.
+ * @param key A pointer to an element to compare with.
+ * @param list A skip list.
+ * @return the position, or null if every element is less than the key.
+ */
+sl_pos* sl_lower_bound(void* key, s_list* list);
+
+/**
+ * @brief Finds the first position whose element is greater than a key.
+ * @param key A pointer to an element to compare with.
+ * @param list A skip list.
+ * @return the position, or null if no element is greater than the key.
+ */
+sl_pos* sl_upper_bound(void* key, s_list* list);
+
+/**
+ * @brief Removes a position from the list and returns its element, in expected O(log n)
+ * time plus the number of elements that compare equal to it.
+ * @param pos A position of the list.
+ * @param list A skip list.
+ * @return the element stored in the position, or null if the position is null.
+ */
+void* sl_delete(sl_pos* pos, s_list* list);
+
+/**
+ * @brief Visits, in order, the elements not less than "low" and less than "high", in
+ * expected O(log n + k) time for k visited elements.
+ * @param list A skip list.
+ * @param low A pointer to the lower bound, or null to start at the first element.
+ * @param high A pointer to the upper bound, or null to run to the last element.
+ * @param func A pointer to the function that visits each element.
+ * @param ctx A pointer that is passed on to "func".
+ * @return the number of elements visited.
+ */
+uint sl_for_range(s_list* list, void* low, void* high, ptr_visit func, void* ctx);
+
+////////////////////// END OF SKIP LIST FUNCTIONS //////////////////////
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @brief This string_pool.h file contains the data structures and functions of a string
+ * intern pool. The pool stores every distinct string once, together with its length and its
+ * hash code, and hands out the stored copy, an "interned string", for every request for an
+ * equal string. Lists and trees of names that repeat the same strings then hold pointers to
+ * one copy instead of one copy per element, and two interned strings of the same pool are
+ * equal exactly when they are the same pointer.
+ *
+ * An interned string is an ordinary null terminated string, so it can be printed and passed
+ * to the string functions of the other containers; its length and hash code are stored in
+ * front of its first character and read in O(1) time. Comparisons of interned strings check
+ * the hash codes first, then the lengths, and only then the characters, so most unequal
+ * strings are rejected without reading them.
+ *
+ * Interned strings stay valid until the pool is destroyed; they must not be modified.
+ *
+ * @note This file only contains the interfaces, no implementation.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#ifndef _DSA_STRING_POOL_H
+#define _DSA_STRING_POOL_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "positional_list.h"
+
+/// @brief The size of the blocks the characters of interned strings are stored in.
+#define SP_BLOCK_SIZE 65536
+
+/// @brief The number of slots the pool's table has when the pool is created.
+#define SP_DEFAULT_CAPACITY 64
+
+
+////////////////////// STRING POOL STRUCTURES //////////////////////
+
+/**
+ * @brief The header stored in front of the characters of an interned string.
+ */
+typedef struct sp_header{
+
+    /// @brief The hash code of the string, the same as "gt_str_hash" computes.
+    size_t hash;
+
+    /// @brief The number of characters, not counting the terminator.
+    uint32_t length;
+
+} sp_header;
+
+/**
+ * @brief A slot of the pool's table. The hash code is kept in the slot too, so that probing
+ * rejects other strings without reading them.
+ */
+typedef struct sp_slot{
+
+    /// @brief The hash code of the string in the slot.
+    size_t hash;
+
+    /// @brief The interned string, or null if the slot is empty.
+    string str;
+
+} sp_slot;
+
+/**
+ * @brief A string intern pool.
+ */
+typedef struct str_pool{
+
+    /// @brief The open addressing table of the interned strings, probed linearly.
+    sp_slot* slots;
+
+    /// @brief The number of slots, a power of two.
+    uint capacity;
+
+    /// @brief The number of distinct strings in the pool.
+    uint num_strings;
+
+    /// @brief The block that new strings are stored in; every block starts with a pointer
+    /// to the block that was filled before it.
+    char* block;
+
+    /// @brief The number of bytes of the current block that are in use.
+    size_t block_used;
+
+    /// @brief The number of bytes of the current block.
+    size_t block_size;
+
+    /// @brief The number of bytes of all the blocks, headers and characters included.
+    size_t block_bytes;
+
+    /// @brief The number of times a string was interned, counting repeats.
+    size_t num_requests;
+
+} str_pool;
+
+////////////////////// END OF STRING POOL STRUCTURES //////////////////////
+
+
+////////////////////// STRING POOL FUNCTIONS //////////////////////
+
+/**
+ * @brief Creates an empty string pool.
+ * @return a pointer to the pool, or null if memory could not be allocated.
+ */
+str_pool* init_str_pool();
+
+/**
+ * @brief Deallocates a string pool and all the strings interned in it.
+ * @param pool A string pool.
+ * @return null.
+ */
+str_pool* destroy_str_pool(str_pool* pool);
+
+/**
+ * @brief Returns the number of distinct strings in the pool.
+ * @param pool A string pool.
+ * @return the number of strings.
+ */
+uint sp_size(str_pool* pool);
+
+/**
+ * @brief Returns the interned copy of a string, storing the string first if the pool does
+ * not have it yet. Runs in O(length) expected time.
+ * @param pool A string pool.
+ * @param str A null terminated string.
+ * @return the interned string, or null if memory could not be allocated.
+ */
+string sp_intern(str_pool* pool, const char* str);
+
+/**
+ * @brief Returns the interned copy of the first "length" characters of a string, storing
+ * them first if the pool does not have them yet.
+ * @param pool A string pool.
+ * @param str The characters, which need not be null terminated.
+ * @param length The number of characters.
+ * @return the interned string, or null if memory could not be allocated.
+ */
+string sp_intern_n(str_pool* pool, const char* str, uint32_t length);
+
+/**
+ * @brief Returns the interned copy of a string without storing it. A string the pool does
+ * not have is not stored in any container whose strings all come from the pool, so the
+ * containers need not be searched for it.
+ * @param pool A string pool.
+ * @param str A null terminated string.
+ * @return the interned string, or null if the pool does not have it.
+ */
+string sp_lookup(str_pool* pool, const char* str);
+
+/**
+ * @brief Returns the hash code of an interned string in O(1) time.
+ * @param str An interned string.
+ * @return the hash code.
+ */
+static inline size_t sp_hash(const char* str){
+    return ((const sp_header*) str - 1)->hash;
+}
+
+/**
+ * @brief Returns the length of an interned string in O(1) time.
+ * @param str An interned string.
+ * @return the number of characters.
+ */
+static inline uint32_t sp_length(const char* str){
+    return ((const sp_header*) str - 1)->length;
+}
+
+/**
+ * @brief Checks if two interned strings, of the same pool or not, are equal: by address,
+ * then hash code, then length, then characters.
+ * @param str_a An interned string.
+ * @param str_b An interned string.
+ * @return true if the strings are equal.
+ */
+bool sp_equals(const char* str_a, const char* str_b);
+
+/**
+ * @brief Hashes a key that is an interned string in O(1) time, in the form of a
+ * "gt_key_hash" function.
+ * @note Every key given to a tree that uses this function, in lookups too, must be
+ * interned; "gt_resolve_path" cuts plain strings out of the path and cannot be used.
+ */
+size_t sp_key_hash(void* data);
+
+/**
+ * @brief Compares keys that are interned strings with "sp_equals", in the form of a
+ * "gt_key_equals" function.
+ * @note Every key given to a tree that uses this function, in lookups too, must be interned.
+ */
+bool sp_key_equals(void* data_a, void* data_b);
+
+/**
+ * @brief Searches a positional list of interned strings for a string, which need not be
+ * interned. The string is hashed once, and every element is compared by hash code, then
+ * length, then characters, so unequal elements are mostly rejected without being read.
+ * Unlike "str_search", which compares addresses, equal strings are found wherever they
+ * were stored.
+ * @param elem_ptr The string to be searched for.
+ * @param list A positional list whose elements are all interned strings.
+ * @return the first position storing an equal string, or null if there is none.
+ */
+pl_pos* sp_search(const char* elem_ptr, p_list* list);
+
+////////////////////// END OF STRING POOL FUNCTIONS //////////////////////
+
+#endif
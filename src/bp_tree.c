@@ -0,0 +1,588 @@
+/**
+ * @brief This bp_tree.c file contains the implementations of the functions that access and
+ * manipulate the "bp_tree" and "bp_node" structs.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/bp_tree.h"
+#include <string.h>
+
+/// @brief The deepest a tree can get: every level multiplies the number of keys by at least
+/// BP_MIN_KEYS + 1, so 64 levels are far more than 64-bit sizes allow.
+#define BP_MAX_HEIGHT 64
+
+////////////////////// NODE HELPERS //////////////////////
+
+/**
+ * @brief Allocates an empty node aligned to a cache line.
+ */
+static bp_node* new_bp_node(bool is_leaf){
+
+    size_t size = (sizeof(bp_node) + BP_NODE_ALIGN - 1) / BP_NODE_ALIGN * BP_NODE_ALIGN;
+    bp_node* node = aligned_alloc(BP_NODE_ALIGN,size);
+
+    if(node != NULL){
+        node->num_keys = 0;
+        node->is_leaf = is_leaf;
+        node->next = NULL;
+    }
+
+    return node;
+}
+
+/**
+ * @brief Deallocates a node and all the nodes below it.
+ */
+static void free_bp_subtree(bp_node* node){
+
+    if(!node->is_leaf){
+        for(uint32_t i=0; i<=node->num_keys; ++i)
+            free_bp_subtree(node->children[i]);
+    }
+
+    free(node);
+}
+
+/**
+ * @brief Returns the number of keys less than a key, with a binary search whose only branch
+ * is the loop, so that the compiler turns the comparison into a conditional move and the
+ * search does not stall on mispredicted branches.
+ */
+static inline uint32_t lower_bound(const int64_t* keys, uint32_t n, int64_t key){
+
+    if(n == 0)
+        return 0;
+
+    const int64_t* base = keys;
+
+    while(n > 1){
+        uint32_t half = n / 2;
+        base = base[half] < key ? base + half : base;
+        n -= half;
+    }
+
+    return (uint32_t) (base - keys) + (*base < key);
+}
+
+/**
+ * @brief Returns the number of keys not greater than a key, branchless like "lower_bound".
+ * In an internal node, that is the index of the child whose subtree may hold the key.
+ */
+static inline uint32_t upper_bound(const int64_t* keys, uint32_t n, int64_t key){
+
+    if(n == 0)
+        return 0;
+
+    const int64_t* base = keys;
+
+    while(n > 1){
+        uint32_t half = n / 2;
+        base = base[half] <= key ? base + half : base;
+        n -= half;
+    }
+
+    return (uint32_t) (base - keys) + (*base <= key);
+}
+
+/**
+ * @brief Descends to the leaf that may hold a key, recording the nodes on the way and the
+ * index of the child taken in each, if "path" is not null.
+ */
+static bp_node* find_leaf(bp_tree* tree, int64_t key, bp_node** path, uint32_t* slots){
+
+    bp_node* node = tree->root;
+    uint32_t depth = 0;
+
+    while(!node->is_leaf){
+        uint32_t i = upper_bound(node->keys,node->num_keys,key);
+        if(path != NULL){
+            path[depth] = node;
+            slots[depth] = i;
+        }
+        ++depth;
+        node = node->children[i];
+    }
+
+    return node;
+}
+
+/**
+ * @brief Splits a node that overflowed into itself and a new right sibling.
+ * @param right An allocated node that becomes the right sibling.
+ * @param sep Receives the key that separates the two nodes in their parent.
+ */
+static void split_node(bp_node* node, bp_node* right, int64_t* sep){
+
+    uint32_t n = node->num_keys;
+    uint32_t keep = n / 2;
+
+    right->is_leaf = node->is_leaf;
+    right->next = NULL;
+
+    if(node->is_leaf){
+        // the leaves share no key; the right leaf's first key goes up as a copy.
+        right->num_keys = n - keep;
+        memcpy(right->keys,node->keys + keep,right->num_keys * sizeof(int64_t));
+        memcpy(right->values,node->values + keep,right->num_keys * sizeof(void*));
+        right->next = node->next;
+        node->next = right;
+        *sep = right->keys[0];
+    }
+    else{
+        // the middle key moves up and is kept by neither node.
+        right->num_keys = n - keep - 1;
+        memcpy(right->keys,node->keys + keep + 1,right->num_keys * sizeof(int64_t));
+        memcpy(right->children,node->children + keep + 1,(right->num_keys + 1) * sizeof(bp_node*));
+        *sep = node->keys[keep];
+    }
+
+    node->num_keys = keep;
+}
+
+/**
+ * @brief Inserts a key and the child to its right into an internal node, which may then
+ * overflow by one key.
+ */
+static void insert_child(bp_node* node, uint32_t i, int64_t key, bp_node* child){
+
+    memmove(node->keys + i + 1,node->keys + i,(node->num_keys - i) * sizeof(int64_t));
+    memmove(node->children + i + 2,node->children + i + 1,(node->num_keys - i) * sizeof(bp_node*));
+    node->keys[i] = key;
+    node->children[i + 1] = child;
+    ++(node->num_keys);
+}
+
+/**
+ * @brief Removes the key i and the child to its right from an internal node.
+ */
+static void remove_child(bp_node* node, uint32_t i){
+
+    memmove(node->keys + i,node->keys + i + 1,(node->num_keys - i - 1) * sizeof(int64_t));
+    memmove(node->children + i + 1,node->children + i + 2,(node->num_keys - i - 1) * sizeof(bp_node*));
+    --(node->num_keys);
+}
+
+/**
+ * @brief Refills a node that fell below BP_MIN_KEYS keys from a sibling, by moving one key
+ * over when the sibling can spare it, or otherwise by merging the two nodes.
+ * @param parent The parent of the node.
+ * @param i The index of the node among the parent's children.
+ * @return true if the nodes were merged, so that the parent lost a key.
+ */
+static bool rebalance(bp_node* parent, uint32_t i){
+
+    bp_node* node = parent->children[i];
+    bp_node* left = i > 0 ? parent->children[i - 1] : NULL;
+    bp_node* right = i < parent->num_keys ? parent->children[i + 1] : NULL;
+
+    if(left != NULL && left->num_keys > BP_MIN_KEYS){
+
+        // move the left sibling's last key to the front of the node.
+        memmove(node->keys + 1,node->keys,node->num_keys * sizeof(int64_t));
+
+        if(node->is_leaf){
+            memmove(node->values + 1,node->values,node->num_keys * sizeof(void*));
+            node->keys[0] = left->keys[left->num_keys - 1];
+            node->values[0] = left->values[left->num_keys - 1];
+            parent->keys[i - 1] = node->keys[0];
+        }
+        else{
+            memmove(node->children + 1,node->children,(node->num_keys + 1) * sizeof(bp_node*));
+            node->keys[0] = parent->keys[i - 1];
+            node->children[0] = left->children[left->num_keys];
+            parent->keys[i - 1] = left->keys[left->num_keys - 1];
+        }
+
+        ++(node->num_keys);
+        --(left->num_keys);
+        return false;
+    }
+
+    if(right != NULL && right->num_keys > BP_MIN_KEYS){
+
+        // move the right sibling's first key to the end of the node.
+        if(node->is_leaf){
+            node->keys[node->num_keys] = right->keys[0];
+            node->values[node->num_keys] = right->values[0];
+            memmove(right->values,right->values + 1,(right->num_keys - 1) * sizeof(void*));
+        }
+        else{
+            node->keys[node->num_keys] = parent->keys[i];
+            node->children[node->num_keys + 1] = right->children[0];
+            memmove(right->children,right->children + 1,right->num_keys * sizeof(bp_node*));
+        }
+
+        parent->keys[i] = node->is_leaf ? right->keys[1] : right->keys[0];
+        memmove(right->keys,right->keys + 1,(right->num_keys - 1) * sizeof(int64_t));
+        ++(node->num_keys);
+        --(right->num_keys);
+        return false;
+    }
+
+    // merge the node with a sibling, the right one of the pair into the left one.
+    uint32_t j = left != NULL ? i - 1 : i;
+    bp_node* dst = parent->children[j];
+    bp_node* src = parent->children[j + 1];
+
+    if(dst->is_leaf){
+        memcpy(dst->keys + dst->num_keys,src->keys,src->num_keys * sizeof(int64_t));
+        memcpy(dst->values + dst->num_keys,src->values,src->num_keys * sizeof(void*));
+        dst->num_keys += src->num_keys;
+        dst->next = src->next;
+    }
+    else{
+        dst->keys[dst->num_keys] = parent->keys[j];
+        memcpy(dst->keys + dst->num_keys + 1,src->keys,src->num_keys * sizeof(int64_t));
+        memcpy(dst->children + dst->num_keys + 1,src->children,(src->num_keys + 1) * sizeof(bp_node*));
+        dst->num_keys += 1 + src->num_keys;
+    }
+
+    remove_child(parent,j);
+    free(src);
+    return true;
+}
+
+////////////////////// END OF NODE HELPERS //////////////////////
+
+
+////////////////////// B+ TREE FUNCTIONS //////////////////////
+
+bp_tree* init_bp_tree(){
+
+    bp_tree* tree = malloc(sizeof(bp_tree));
+
+    if(tree == NULL)
+        return NULL;
+
+    tree->root = new_bp_node(true);
+
+    if(tree->root == NULL){
+        free(tree);
+        return NULL;
+    }
+
+    tree->first_leaf = tree->root;
+    tree->size = 0;
+    tree->height = 1;
+
+    return tree;
+}
+
+bp_tree* destroy_bp_tree(bp_tree* tree){
+
+    if(tree != NULL){
+        free_bp_subtree(tree->root);
+        free(tree);
+    }
+
+    return NULL;
+}
+
+size_t bp_size(bp_tree* tree){
+    return (tree != NULL) ? tree->size : 0;
+}
+
+void* bp_get(bp_tree* tree, int64_t key){
+
+    if(tree == NULL)
+        return NULL;
+
+    bp_node* leaf = find_leaf(tree,key,NULL,NULL);
+    uint32_t i = lower_bound(leaf->keys,leaf->num_keys,key);
+
+    return (i < leaf->num_keys && leaf->keys[i] == key) ? leaf->values[i] : NULL;
+}
+
+bool bp_contains(bp_tree* tree, int64_t key){
+    return bp_get(tree,key) != NULL;
+}
+
+bool bp_put(bp_tree* tree, int64_t key, void* value, void** old_value){
+
+    if(old_value != NULL)
+        *old_value = NULL;
+
+    if(tree == NULL || value == NULL)
+        return false;
+
+    bp_node* path[BP_MAX_HEIGHT];
+    uint32_t slots[BP_MAX_HEIGHT];
+    bp_node* leaf = find_leaf(tree,key,path,slots);
+    uint32_t i = lower_bound(leaf->keys,leaf->num_keys,key);
+
+    if(i < leaf->num_keys && leaf->keys[i] == key){
+        if(old_value != NULL)
+            *old_value = leaf->values[i];
+        leaf->values[i] = value;
+        return true;
+    }
+
+    // the leaf splits if it is full, and so does every full ancestor above a split node;
+    // a split root needs a new root too. Allocate them all before changing anything, so
+    // that a failed allocation leaves the tree as it was.
+    uint32_t depth = tree->height - 1;
+    bp_node* spare[BP_MAX_HEIGHT + 1];
+    uint32_t num_spare = 0;
+
+    if(leaf->num_keys == BP_MAX_KEYS){
+
+        uint32_t d = depth;
+        uint32_t need = 1;
+
+        while(d > 0 && path[d - 1]->num_keys == BP_MAX_KEYS){
+            ++need;
+            --d;
+        }
+
+        if(d == 0)
+            ++need;
+
+        while(num_spare < need){
+            spare[num_spare] = new_bp_node(false);
+            if(spare[num_spare] == NULL){
+                while(num_spare > 0)
+                    free(spare[--num_spare]);
+                return false;
+            }
+            ++num_spare;
+        }
+    }
+
+    memmove(leaf->keys + i + 1,leaf->keys + i,(leaf->num_keys - i) * sizeof(int64_t));
+    memmove(leaf->values + i + 1,leaf->values + i,(leaf->num_keys - i) * sizeof(void*));
+    leaf->keys[i] = key;
+    leaf->values[i] = value;
+    ++(leaf->num_keys);
+    ++(tree->size);
+
+    // split the overflowing nodes from the leaf upwards.
+    bp_node* node = leaf;
+    uint32_t used = 0;
+
+    while(node->num_keys > BP_MAX_KEYS){
+
+        int64_t sep;
+        bp_node* right = spare[used++];
+        split_node(node,right,&sep);
+
+        if(depth == 0){
+            bp_node* root = spare[used++];
+            root->num_keys = 1;
+            root->keys[0] = sep;
+            root->children[0] = node;
+            root->children[1] = right;
+            tree->root = root;
+            ++(tree->height);
+            break;
+        }
+
+        --depth;
+        insert_child(path[depth],slots[depth],sep,right);
+        node = path[depth];
+    }
+
+    return true;
+}
+
+void* bp_remove(bp_tree* tree, int64_t key){
+
+    if(tree == NULL)
+        return NULL;
+
+    bp_node* path[BP_MAX_HEIGHT];
+    uint32_t slots[BP_MAX_HEIGHT];
+    bp_node* leaf = find_leaf(tree,key,path,slots);
+    uint32_t i = lower_bound(leaf->keys,leaf->num_keys,key);
+
+    if(i == leaf->num_keys || leaf->keys[i] != key)
+        return NULL;
+
+    void* value = leaf->values[i];
+    memmove(leaf->keys + i,leaf->keys + i + 1,(leaf->num_keys - i - 1) * sizeof(int64_t));
+    memmove(leaf->values + i,leaf->values + i + 1,(leaf->num_keys - i - 1) * sizeof(void*));
+    --(leaf->num_keys);
+    --(tree->size);
+
+    // refill the nodes that fell below the minimum, from the leaf upwards.
+    bp_node* node = leaf;
+    uint32_t depth = tree->height - 1;
+
+    while(depth > 0 && node->num_keys < BP_MIN_KEYS){
+        --depth;
+        if(!rebalance(path[depth],slots[depth]))
+            break;
+        node = path[depth];
+    }
+
+    // a root left with a single child is replaced by that child.
+    if(!tree->root->is_leaf && tree->root->num_keys == 0){
+        bp_node* old_root = tree->root;
+        tree->root = old_root->children[0];
+        --(tree->height);
+        free(old_root);
+    }
+
+    return value;
+}
+
+/**
+ * @brief Returns the number of nodes a level of "count" nodes is grouped under: as few as
+ * hold BP_MAX_KEYS + 1 children each, which then each get more than half of that.
+ */
+static inline size_t num_parents_of(size_t count){
+    return (count + BP_MAX_KEYS) / (BP_MAX_KEYS + 1);
+}
+
+bool bp_bulk_load(bp_tree* tree, const int64_t* keys, void* const* values, size_t n){
+
+    if(tree == NULL || tree->size > 0 || (n > 0 && (keys == NULL || values == NULL)))
+        return false;
+
+    for(size_t i=0; i<n; ++i){
+        if(values[i] == NULL || (i > 0 && keys[i - 1] >= keys[i]))
+            return false;
+    }
+
+    if(n == 0)
+        return true;
+
+    // spread the keys evenly over as few leaves as hold them, so that with more than one
+    // leaf, each gets more than BP_MAX_KEYS / 2 keys. Count the nodes of all the levels and
+    // allocate them first, so that building cannot fail halfway.
+    size_t num_leaves = (n + BP_MAX_KEYS - 1) / BP_MAX_KEYS;
+    size_t total = num_leaves;
+
+    for(size_t count = num_leaves; count > 1; count = num_parents_of(count))
+        total += num_parents_of(count);
+
+    bp_node** nodes = malloc(total * sizeof(bp_node*));
+    int64_t* lows = malloc(num_leaves * sizeof(int64_t));
+    size_t num_alloc = 0;
+
+    if(nodes != NULL && lows != NULL){
+        for(; num_alloc < total; ++num_alloc){
+            nodes[num_alloc] = new_bp_node(num_alloc < num_leaves);
+            if(nodes[num_alloc] == NULL)
+                break;
+        }
+    }
+
+    if(nodes == NULL || lows == NULL || num_alloc < total){
+        for(size_t i=0; i<num_alloc; ++i)
+            free(nodes[i]);
+        free(nodes);
+        free(lows);
+        return false;
+    }
+
+    for(size_t k=0, start=0; k<num_leaves; ++k){
+
+        size_t count = n / num_leaves + (k < n % num_leaves ? 1 : 0);
+        bp_node* leaf = nodes[k];
+
+        leaf->num_keys = (uint32_t) count;
+        memcpy(leaf->keys,keys + start,count * sizeof(int64_t));
+        memcpy(leaf->values,values + start,count * sizeof(void*));
+        leaf->next = k + 1 < num_leaves ? nodes[k + 1] : NULL;
+
+        lows[k] = keys[start];
+        start += count;
+    }
+
+    // group the nodes of each level under the parents that follow them in the array; the
+    // smallest key of every subtree separates it from the one before it.
+    bp_node** level = nodes;
+    size_t num_level = num_leaves;
+    uint32_t height = 1;
+
+    while(num_level > 1){
+
+        size_t num_parents = num_parents_of(num_level);
+        bp_node** parents = level + num_level;
+
+        for(size_t p=0, start=0; p<num_parents; ++p){
+
+            size_t count = num_level / num_parents + (p < num_level % num_parents ? 1 : 0);
+            bp_node* parent = parents[p];
+
+            parent->num_keys = (uint32_t) count - 1;
+            for(size_t c=0; c<count; ++c){
+                parent->children[c] = level[start + c];
+                if(c > 0)
+                    parent->keys[c - 1] = lows[start + c];
+            }
+
+            // the parents' lows overwrite the front of the array, which is already read.
+            lows[p] = lows[start];
+            start += count;
+        }
+
+        level = parents;
+        num_level = num_parents;
+        ++height;
+    }
+
+    free(tree->root);
+    tree->root = level[0];
+    tree->first_leaf = nodes[0];
+    tree->size = n;
+    tree->height = height;
+
+    free(nodes);
+    free(lows);
+    return true;
+}
+
+bp_iter bp_seek(bp_tree* tree, int64_t key){
+
+    bp_iter iter = {NULL,0};
+
+    if(tree == NULL)
+        return iter;
+
+    bp_node* leaf = find_leaf(tree,key,NULL,NULL);
+    uint32_t i = lower_bound(leaf->keys,leaf->num_keys,key);
+
+    // the key may be past the end of its leaf; the next leaf then starts the sequence.
+    if(i == leaf->num_keys){
+        leaf = leaf->next;
+        i = 0;
+    }
+
+    iter.leaf = leaf;
+    iter.index = i;
+    return iter;
+}
+
+size_t bp_for_range(bp_tree* tree, int64_t low, int64_t high, bp_visit func, void* ctx){
+
+    if(tree == NULL || func == NULL || low >= high)
+        return 0;
+
+    size_t count = 0;
+    bp_iter iter = bp_seek(tree,low);
+
+    while(iter.leaf != NULL){
+
+        // visit the rest of the leaf in one go, up to the first key not below "high".
+        bp_node* leaf = iter.leaf;
+        uint32_t end = leaf->keys[leaf->num_keys - 1] < high ? leaf->num_keys : lower_bound(leaf->keys,leaf->num_keys,high);
+
+        for(uint32_t i=iter.index; i<end; ++i)
+            func(leaf->keys[i],leaf->values[i],ctx);
+
+        count += end - iter.index;
+
+        if(end < leaf->num_keys)
+            break;
+
+        iter.leaf = leaf->next;
+        iter.index = 0;
+    }
+
+    return count;
+}
+
+////////////////////// END OF B+ TREE FUNCTIONS //////////////////////
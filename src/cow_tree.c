@@ -0,0 +1,426 @@
+/**
+ * @brief This cow_tree.c file contains the implementations of the functions that access and
+ * manipulate the "cow_tree", "ct_node" and "ct_snapshot" structs.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/cow_tree.h"
+#include <string.h>
+
+//////////////////////////////// NODE HELPERS ////////////////////////////////
+
+/**
+ * @brief Creates a position with one reference and no children.
+ */
+static ct_node* node_new(void* data){
+
+    ct_node* node = malloc(sizeof(ct_node));
+
+    if(node != NULL){
+        node->data_ptr = data;
+        node->children = NULL;
+        node->num_children = 0;
+        node->num_children_cap = 0;
+        atomic_init(&node->refcount,1);
+    }
+
+    return node;
+}
+
+/**
+ * @brief Adds a reference to a position.
+ */
+static inline void node_retain(ct_node* node){
+    atomic_fetch_add_explicit(&node->refcount,1,memory_order_relaxed);
+}
+
+/**
+ * @brief Drops a reference to a position, reclaiming it and, in turn, every descendant
+ * whose last reference it held. Uses an explicit stack so that deep trees are safe.
+ */
+static void node_release(ct_node* node){
+
+    if(node == NULL)
+        return;
+
+    ct_node** stack = NULL;
+    unsigned int top = 0;
+    unsigned int cap = 0;
+    ct_node* curr = node;
+
+    while(curr != NULL){
+
+        // acquire ordering makes the other releasers' reads of the position happen before it is freed.
+        if(atomic_fetch_sub_explicit(&curr->refcount,1,memory_order_acq_rel) == 1){
+
+            if(top + curr->num_children > cap){
+                unsigned int new_cap = cap > 0 ? cap * 2 : 64;
+                while(new_cap < top + curr->num_children)
+                    new_cap *= 2;
+                ct_node** grown = realloc(stack,new_cap * sizeof(ct_node*));
+                if(grown == NULL){
+                    // leak the rest rather than free a position that is still referenced.
+                    break;
+                }
+                stack = grown;
+                cap = new_cap;
+            }
+
+            if(curr->num_children > 0)
+                memcpy(stack + top,curr->children,curr->num_children * sizeof(ct_node*));
+            top += curr->num_children;
+            free(curr->children);
+            free(curr);
+        }
+
+        curr = top > 0 ? stack[--top] : NULL;
+    }
+
+    free(stack);
+}
+
+/**
+ * @brief Returns the position stored in *slot, replacing it first by a private copy if it is
+ * shared with a snapshot. The copy refers to the same children, which gain a reference.
+ * @return the position that can be modified, or null if memory could not be allocated.
+ */
+static ct_node* make_writable(ct_node** slot){
+
+    ct_node* node = *slot;
+
+    if(atomic_load_explicit(&node->refcount,memory_order_acquire) == 1)
+        return node;
+
+    ct_node* copy = node_new(node->data_ptr);
+
+    if(copy == NULL)
+        return NULL;
+
+    if(node->num_children > 0){
+
+        copy->children = malloc(node->num_children * sizeof(ct_node*));
+
+        if(copy->children == NULL){
+            free(copy);
+            return NULL;
+        }
+
+        memcpy(copy->children,node->children,node->num_children * sizeof(ct_node*));
+        copy->num_children = copy->num_children_cap = node->num_children;
+
+        for(unsigned int i=0; i<copy->num_children; ++i)
+            node_retain(copy->children[i]);
+    }
+
+    *slot = copy;
+    node_release(node);
+    return copy;
+}
+
+/**
+ * @brief Returns the position at the end of a path starting at root, or null.
+ */
+static ct_node* resolve_from(ct_node* root, const unsigned int* path, unsigned int depth){
+
+    ct_node* node = root;
+
+    for(unsigned int i=0; i<depth && node != NULL; ++i)
+        node = path[i] < node->num_children ? node->children[path[i]] : NULL;
+
+    return node;
+}
+
+/**
+ * @brief Makes every position on a path private to the current version, copying the shared
+ * ones, and returns the position at the end of the path.
+ * @return the position at the end of the path, or null if the path does not exist or
+ * memory could not be allocated.
+ */
+static ct_node* writable_path(cow_tree* tree, const unsigned int* path, unsigned int depth){
+
+    if(tree->root == NULL || (depth > 0 && path == NULL) || resolve_from(tree->root,path,depth) == NULL)
+        return NULL;
+
+    ct_node* node = make_writable(&tree->root);
+
+    for(unsigned int i=0; i<depth && node != NULL; ++i)
+        node = make_writable(&node->children[path[i]]);
+
+    return node;
+}
+
+/**
+ * @brief Counts the positions in the subtree rooted at a position.
+ */
+static unsigned int subtree_size(ct_node* node){
+
+    unsigned int count = 0;
+    unsigned int top = 0;
+    unsigned int cap = 64;
+    ct_node** stack = malloc(cap * sizeof(ct_node*));
+
+    if(stack == NULL)
+        return 0;
+
+    stack[top++] = node;
+
+    while(top > 0){
+
+        ct_node* curr = stack[--top];
+        ++count;
+
+        if(top + curr->num_children > cap){
+            while(cap < top + curr->num_children)
+                cap *= 2;
+            ct_node** grown = realloc(stack,cap * sizeof(ct_node*));
+            if(grown == NULL)
+                break;
+            stack = grown;
+        }
+
+        if(curr->num_children > 0)
+            memcpy(stack + top,curr->children,curr->num_children * sizeof(ct_node*));
+        top += curr->num_children;
+    }
+
+    free(stack);
+    return count;
+}
+
+//////////////////////////////// END OF NODE HELPERS ////////////////////////////////
+
+
+//////////////////////////////// WRITER FUNCTIONS ////////////////////////////////
+
+cow_tree* init_cow_tree(){
+
+    cow_tree* tree = malloc(sizeof(cow_tree));
+
+    if(tree != NULL){
+        tree->root = NULL;
+        tree->size = 0;
+    }
+
+    return tree;
+}
+
+cow_tree* ct_from_gt(g_tree* tree){
+
+    cow_tree* copy = init_cow_tree();
+
+    if(copy == NULL || tree == NULL || !has_root(tree))
+        return copy;
+
+    gt_pos** src = malloc(get_size(tree) * sizeof(gt_pos*));
+    ct_node** dst = malloc(get_size(tree) * sizeof(ct_node*));
+    unsigned int top = 0;
+
+    if(src == NULL || dst == NULL || (copy->root = node_new(get_root(tree)->data_ptr)) == NULL){
+        free(src);
+        free(dst);
+        free(copy);
+        return NULL;
+    }
+
+    copy->size = 1;
+    src[top] = get_root(tree);
+    dst[top++] = copy->root;
+
+    bool failed = false;
+
+    // copy the positions depth first, giving each an array of children of exactly its size.
+    while(top > 0 && !failed){
+
+        gt_pos* pos = src[--top];
+        ct_node* node = dst[top];
+
+        if(pos->num_children == 0)
+            continue;
+
+        node->children = malloc(pos->num_children * sizeof(ct_node*));
+
+        if(node->children == NULL){
+            failed = true;
+            break;
+        }
+
+        node->num_children_cap = pos->num_children;
+
+        for(unsigned int i=0; i<pos->num_children; ++i){
+
+            ct_node* child = node_new(pos->children[i]->data_ptr);
+
+            if(child == NULL){
+                failed = true;
+                break;
+            }
+
+            node->children[node->num_children++] = child;
+            ++copy->size;
+            src[top] = pos->children[i];
+            dst[top++] = child;
+        }
+    }
+
+    free(src);
+    free(dst);
+
+    // a partial copy is not the tree, so it is released rather than returned.
+    if(failed)
+        return destroy_cow_tree(copy);
+
+    return copy;
+}
+
+cow_tree* destroy_cow_tree(cow_tree* tree){
+
+    if(tree != NULL){
+        node_release(tree->root);
+        free(tree);
+    }
+
+    return NULL;
+}
+
+bool ct_add_root(cow_tree* tree, void* data){
+
+    if(tree == NULL || tree->root != NULL || (tree->root = node_new(data)) == NULL)
+        return false;
+
+    tree->size = 1;
+    return true;
+}
+
+long ct_add_child(cow_tree* tree, const unsigned int* path, unsigned int depth, void* data){
+
+    if(tree == NULL)
+        return -1;
+
+    ct_node* parent = writable_path(tree,path,depth);
+
+    if(parent == NULL)
+        return -1;
+
+    // the parent is private to the current version, so its array can grow in place.
+    if(parent->num_children == parent->num_children_cap){
+
+        unsigned int new_cap = parent->num_children_cap > 0 ? parent->num_children_cap * 2 : 4;
+        ct_node** children = realloc(parent->children,new_cap * sizeof(ct_node*));
+
+        if(children == NULL)
+            return -1;
+
+        parent->children = children;
+        parent->num_children_cap = new_cap;
+    }
+
+    ct_node* child = node_new(data);
+
+    if(child == NULL)
+        return -1;
+
+    parent->children[parent->num_children] = child;
+    ++tree->size;
+    return parent->num_children++;
+}
+
+void* ct_set(cow_tree* tree, const unsigned int* path, unsigned int depth, void* data){
+
+    if(tree == NULL)
+        return NULL;
+
+    ct_node* node = writable_path(tree,path,depth);
+
+    if(node == NULL)
+        return NULL;
+
+    void* old_data = node->data_ptr;
+    node->data_ptr = data;
+    return old_data;
+}
+
+bool ct_remove(cow_tree* tree, const unsigned int* path, unsigned int depth){
+
+    if(tree == NULL || tree->root == NULL)
+        return false;
+
+    if(depth == 0){
+        node_release(tree->root);
+        tree->root = NULL;
+        tree->size = 0;
+        return true;
+    }
+
+    if(path == NULL || resolve_from(tree->root,path,depth) == NULL)
+        return false;
+
+    ct_node* parent = writable_path(tree,path,depth - 1);
+
+    if(parent == NULL)
+        return false;
+
+    unsigned int index = path[depth - 1];
+    ct_node* child = parent->children[index];
+
+    tree->size -= subtree_size(child);
+    memmove(parent->children + index,parent->children + index + 1,(parent->num_children - index - 1) * sizeof(ct_node*));
+    --parent->num_children;
+    node_release(child);
+    return true;
+}
+
+ct_snapshot* ct_take_snapshot(cow_tree* tree){
+
+    if(tree == NULL)
+        return NULL;
+
+    ct_snapshot* snap = malloc(sizeof(ct_snapshot));
+
+    if(snap != NULL){
+        snap->root = tree->root;
+        snap->size = tree->size;
+        if(snap->root != NULL)
+            node_retain(snap->root);
+    }
+
+    return snap;
+}
+
+//////////////////////////////// END OF WRITER FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// READER FUNCTIONS ////////////////////////////////
+
+ct_snapshot* ct_release_snapshot(ct_snapshot* snap){
+
+    if(snap != NULL){
+        node_release(snap->root);
+        free(snap);
+    }
+
+    return NULL;
+}
+
+ct_node* ct_resolve(ct_snapshot* snap, const unsigned int* path, unsigned int depth){
+
+    if(snap == NULL || (depth > 0 && path == NULL))
+        return NULL;
+
+    return resolve_from(snap->root,path,depth);
+}
+
+ct_node* ct_child(ct_node* node, unsigned int i){
+    return (node != NULL && i < node->num_children) ? node->children[i] : NULL;
+}
+
+unsigned int ct_num_children(ct_node* node){
+    return node != NULL ? node->num_children : 0;
+}
+
+void* ct_element(ct_node* node){
+    return node != NULL ? node->data_ptr : NULL;
+}
+
+//////////////////////////////// END OF READER FUNCTIONS ////////////////////////////////
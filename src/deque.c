@@ -0,0 +1,307 @@
+/**
+ * @brief This deque.c file contains the implementations of the functions that access and
+ * manipulate the "rb_deque", "a_queue" and "a_stack" structs.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/deque.h"
+#include <string.h>
+
+////////////////////// RING BUFFER HELPERS //////////////////////
+
+/**
+ * @brief Maps an index counted from the front of the deque to an index of the array.
+ */
+static inline uint slot(rb_deque* dq, uint i){
+    return (dq->front + i) & (dq->capacity - 1);
+}
+
+/**
+ * @brief Copies n elements starting at the array index "from" out of the ring into a flat
+ * array, in at most two runs.
+ */
+static void copy_out(rb_deque* dq, uint from, void** out, uint n){
+
+    uint run = dq->capacity - from < n ? dq->capacity - from : n;
+    memcpy(out, dq->data + from, run * sizeof(void*));
+    memcpy(out + run, dq->data, (n - run) * sizeof(void*));
+}
+
+/**
+ * @brief Copies n elements from a flat array into the ring starting at the array index "to",
+ * in at most two runs.
+ */
+static void copy_in(rb_deque* dq, uint to, void** elems, uint n){
+
+    uint run = dq->capacity - to < n ? dq->capacity - to : n;
+    memcpy(dq->data + to, elems, run * sizeof(void*));
+    memcpy(dq->data, elems + run, (n - run) * sizeof(void*));
+}
+
+/**
+ * @brief Makes sure the array has room for "extra" more elements, at least doubling its
+ * capacity when it grows, and unwrapping the elements to the start of the new array.
+ */
+static BOOL reserve(rb_deque* dq, uint extra){
+
+    uint needed = dq->num_elements + extra;
+
+    if(needed <= dq->capacity)
+        return TRUE;
+
+    uint new_cap = dq->capacity * 2;
+    while(new_cap < needed)
+        new_cap *= 2;
+
+    void** data = malloc(new_cap * sizeof(void*));
+
+    if(data == NULL)
+        return FALSE;
+
+    copy_out(dq, dq->front, data, dq->num_elements);
+    free(dq->data);
+
+    dq->data = data;
+    dq->capacity = new_cap;
+    dq->front = 0;
+    return TRUE;
+}
+
+////////////////////// END OF RING BUFFER HELPERS //////////////////////
+
+
+////////////////////// DEQUE FUNCTIONS //////////////////////
+
+rb_deque* init_deque(){
+
+    rb_deque* dq = malloc(sizeof(rb_deque));
+
+    if(dq != NULL){
+        dq->data = malloc(DQ_DEFAULT_CAPACITY * sizeof(void*));
+
+        if(dq->data == NULL){
+            free(dq);
+            return NULL;
+        }
+
+        dq->capacity = DQ_DEFAULT_CAPACITY;
+        dq->front = 0;
+        dq->num_elements = 0;
+    }
+
+    return dq;
+}
+
+rb_deque* destroy_deque(rb_deque* dq){
+
+    if(dq != NULL){
+        free(dq->data);
+        dq->data = NULL;
+        free(dq);
+    }
+
+    return NULL;
+}
+
+BOOL dq_is_empty(rb_deque* dq){
+    return (dq != NULL && dq->num_elements > 0) ? FALSE : TRUE;
+}
+
+uint dq_size(rb_deque* dq){
+    return dq != NULL ? dq->num_elements : 0;
+}
+
+BOOL dq_add_first(void* elem_ptr, rb_deque* dq){
+
+    if(dq == NULL || reserve(dq, 1) == FALSE)
+        return FALSE;
+
+    dq->front = (dq->front - 1) & (dq->capacity - 1);
+    dq->data[dq->front] = elem_ptr;
+    ++dq->num_elements;
+    return TRUE;
+}
+
+BOOL dq_add_last(void* elem_ptr, rb_deque* dq){
+
+    if(dq == NULL || reserve(dq, 1) == FALSE)
+        return FALSE;
+
+    dq->data[slot(dq, dq->num_elements)] = elem_ptr;
+    ++dq->num_elements;
+    return TRUE;
+}
+
+void* dq_first(rb_deque* dq){
+    return dq_is_empty(dq) == FALSE ? dq->data[dq->front] : NULL;
+}
+
+void* dq_last(rb_deque* dq){
+    return dq_is_empty(dq) == FALSE ? dq->data[slot(dq, dq->num_elements - 1)] : NULL;
+}
+
+void* dq_get(uint i, rb_deque* dq){
+    return (dq != NULL && i < dq->num_elements) ? dq->data[slot(dq, i)] : NULL;
+}
+
+void* dq_delete_first(rb_deque* dq){
+
+    if(dq_is_empty(dq) == TRUE)
+        return NULL;
+
+    void* elem_ptr = dq->data[dq->front];
+    dq->front = slot(dq, 1);
+    --dq->num_elements;
+    return elem_ptr;
+}
+
+void* dq_delete_last(rb_deque* dq){
+
+    if(dq_is_empty(dq) == TRUE)
+        return NULL;
+
+    --dq->num_elements;
+    return dq->data[slot(dq, dq->num_elements)];
+}
+
+BOOL dq_add_last_n(void** elems, uint n, rb_deque* dq){
+
+    if(dq == NULL || (elems == NULL && n > 0) || reserve(dq, n) == FALSE)
+        return FALSE;
+
+    copy_in(dq, slot(dq, dq->num_elements), elems, n);
+    dq->num_elements += n;
+    return TRUE;
+}
+
+uint dq_delete_first_n(void** out, uint n, rb_deque* dq){
+
+    if(dq == NULL || out == NULL)
+        return 0;
+
+    n = n < dq->num_elements ? n : dq->num_elements;
+    copy_out(dq, dq->front, out, n);
+    dq->front = slot(dq, n);
+    dq->num_elements -= n;
+    return n;
+}
+
+uint dq_delete_last_n(void** out, uint n, rb_deque* dq){
+
+    if(dq == NULL || out == NULL)
+        return 0;
+
+    n = n < dq->num_elements ? n : dq->num_elements;
+
+    for(uint i=0; i<n; ++i)
+        out[i] = dq->data[slot(dq, dq->num_elements - 1 - i)];
+
+    dq->num_elements -= n;
+    return n;
+}
+
+////////////////////// END OF DEQUE FUNCTIONS //////////////////////
+
+
+////////////////////// QUEUE FUNCTIONS //////////////////////
+
+a_queue* init_queue(){
+
+    a_queue* q = malloc(sizeof(a_queue));
+
+    if(q != NULL && (q->dq = init_deque()) == NULL){
+        free(q);
+        return NULL;
+    }
+
+    return q;
+}
+
+a_queue* destroy_queue(a_queue* q){
+
+    if(q != NULL){
+        q->dq = destroy_deque(q->dq);
+        free(q);
+    }
+
+    return NULL;
+}
+
+BOOL enqueue(void* elem_ptr, a_queue* q){
+    return q != NULL ? dq_add_last(elem_ptr, q->dq) : FALSE;
+}
+
+void* dequeue(a_queue* q){
+    return q != NULL ? dq_delete_first(q->dq) : NULL;
+}
+
+void* queue_first(a_queue* q){
+    return q != NULL ? dq_first(q->dq) : NULL;
+}
+
+BOOL enqueue_n(void** elems, uint n, a_queue* q){
+    return q != NULL ? dq_add_last_n(elems, n, q->dq) : FALSE;
+}
+
+uint dequeue_n(void** out, uint n, a_queue* q){
+    return q != NULL ? dq_delete_first_n(out, n, q->dq) : 0;
+}
+
+uint queue_size(a_queue* q){
+    return q != NULL ? dq_size(q->dq) : 0;
+}
+
+////////////////////// END OF QUEUE FUNCTIONS //////////////////////
+
+
+////////////////////// STACK FUNCTIONS //////////////////////
+
+a_stack* init_stack(){
+
+    a_stack* s = malloc(sizeof(a_stack));
+
+    if(s != NULL && (s->dq = init_deque()) == NULL){
+        free(s);
+        return NULL;
+    }
+
+    return s;
+}
+
+a_stack* destroy_stack(a_stack* s){
+
+    if(s != NULL){
+        s->dq = destroy_deque(s->dq);
+        free(s);
+    }
+
+    return NULL;
+}
+
+BOOL push(void* elem_ptr, a_stack* s){
+    return s != NULL ? dq_add_last(elem_ptr, s->dq) : FALSE;
+}
+
+void* pop(a_stack* s){
+    return s != NULL ? dq_delete_last(s->dq) : NULL;
+}
+
+void* top(a_stack* s){
+    return s != NULL ? dq_last(s->dq) : NULL;
+}
+
+BOOL push_n(void** elems, uint n, a_stack* s){
+    return s != NULL ? dq_add_last_n(elems, n, s->dq) : FALSE;
+}
+
+uint pop_n(void** out, uint n, a_stack* s){
+    return s != NULL ? dq_delete_last_n(out, n, s->dq) : 0;
+}
+
+uint stack_size(a_stack* s){
+    return s != NULL ? dq_size(s->dq) : 0;
+}
+
+////////////////////// END OF STACK FUNCTIONS //////////////////////
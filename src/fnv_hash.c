@@ -0,0 +1,20 @@
+/**
+ * @brief This fnv_hash.c file contains the implementation of the 64-bit FNV-1a hash.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/fnv_hash.h"
+
+uint64_t fnv_hash(uint64_t h, const void* bytes, size_t length){
+
+    const unsigned char* b = bytes;
+
+    for(size_t i=0; i<length; ++i){
+        h ^= b[i];
+        h *= FNV_PRIME;
+    }
+
+    return h;
+}
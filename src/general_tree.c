@@ -1,9 +1,343 @@
 #include "../include/general_tree.h"
+#include "../include/fnv_hash.h"
+#include <stdint.h>
+#include <limits.h>
+
+/// @brief Marks a child index slot whose child was removed, so that probing continues past it.
+static gt_pos removed_child;
+#define REMOVED_CHILD (&removed_child)
+
+//////////////////////////////// CHILD INDEX HELPERS ////////////////////////////////
+
+size_t gt_mix_hash(size_t h){
+    uint64_t x = (uint64_t) h;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (size_t) x;
+}
+
+/**
+ * @brief Stores a child in the first empty or removed slot of its probe sequence.
+ */
+static void index_place(gt_child_index* index, gt_pos* child, size_t hash){
+
+    unsigned int mask = index->cap - 1;
+    unsigned int i = hash & mask;
+
+    while(index->slots[i].child != NULL && index->slots[i].child != REMOVED_CHILD)
+        i = (i + 1) & mask;
+
+    if(index->slots[i].child == REMOVED_CHILD)
+        --index->num_removed;
+
+    index->slots[i].hash = hash;
+    index->slots[i].child = child;
+    ++index->count;
+}
+
+/**
+ * @brief Reallocates the slots of the index with room for at least "count" children at
+ * half load, dropping the removed child markers.
+ * @return true if the slots were reallocated.
+ */
+static bool index_rehash(gt_child_index* index, unsigned int count){
+
+    unsigned int cap = 16;
+    while(cap < count * 2)
+        cap *= 2;
+
+    gt_index_slot* old_slots = index->slots;
+    unsigned int old_cap = index->cap;
+    gt_index_slot* slots = calloc(cap,sizeof(gt_index_slot));
+
+    if(slots == NULL)
+        return false;
+
+    index->slots = slots;
+    index->cap = cap;
+    index->count = 0;
+    index->num_removed = 0;
+
+    for(unsigned int i=0; i<old_cap; ++i){
+        if(old_slots[i].child != NULL && old_slots[i].child != REMOVED_CHILD)
+            index_place(index,old_slots[i].child,old_slots[i].hash);
+    }
+
+    free(old_slots);
+    return true;
+}
+
+/**
+ * @brief Adds a child to the index of its parent.
+ * @return false if the index could not grow, in which case the child is not in it and the
+ * index must be dropped.
+ */
+static bool index_insert(gt_child_index* index, gt_pos* child){
+
+    if((index->count + index->num_removed + 1) * 2 > index->cap && !index_rehash(index,index->count + 1))
+        return false;
+
+    index_place(index,child,gt_mix_hash(index->hash(child->data_ptr)));
+    return true;
+}
+
+/**
+ * @brief Returns the slot holding a child whose key equals "key", or -1 if there is none.
+ */
+static long index_find(gt_child_index* index, void* key, size_t hash){
+
+    unsigned int mask = index->cap - 1;
+
+    for(unsigned int i = hash & mask; index->slots[i].child != NULL; i = (i + 1) & mask){
+        gt_pos* child = index->slots[i].child;
+        if(child != REMOVED_CHILD && index->slots[i].hash == hash && index->equals(child->data_ptr,key))
+            return i;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Removes a child from the index of its parent.
+ */
+static void index_remove(gt_child_index* index, gt_pos* child){
+
+    unsigned int mask = index->cap - 1;
+    size_t hash = gt_mix_hash(index->hash(child->data_ptr));
+
+    for(unsigned int i = hash & mask; index->slots[i].child != NULL; i = (i + 1) & mask){
+        if(index->slots[i].child == child){
+            index->slots[i].child = REMOVED_CHILD;
+            ++index->num_removed;
+            --index->count;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Creates the child index of a position and adds all its current children to it.
+ * @return the index, or null if memory could not be allocated.
+ */
+static gt_child_index* index_build(gt_pos* pos, g_tree* tree){
+
+    gt_child_index* index = malloc(sizeof(gt_child_index));
+
+    if(index == NULL)
+        return NULL;
+
+    index->slots = NULL;
+    index->cap = 0;
+    index->hash = tree->key_hash;
+    index->equals = tree->key_equals;
+
+    if(!index_rehash(index,pos->num_children)){
+        free(index);
+        return NULL;
+    }
+
+    for(unsigned int i=0; i<pos->num_children; ++i)
+        index_place(index,pos->children[i],gt_mix_hash(index->hash(pos->children[i]->data_ptr)));
+
+    return index;
+}
+
+/**
+ * @brief Deallocates a child index.
+ */
+static gt_child_index* index_destroy(gt_child_index* index){
+
+    if(index != NULL){
+        free(index->slots);
+        free(index);
+    }
+
+    return NULL;
+}
+
+//////////////////////////////// END OF CHILD INDEX HELPERS ////////////////////////////////
+
+
+//////////////////////////////// SUBTREE HASH HELPERS ////////////////////////////////
+
+/**
+ * @brief Discards the cached subtree hashes of a position and its ancestors. A position
+ * whose hash is not cached has no ancestor with a cached hash, so the climb stops there.
+ */
+static void invalidate_hashes(gt_pos* pos){
+
+    while(pos != NULL && pos->subtree_hash != 0){
+        pos->subtree_hash = 0;
+        pos = pos->parent;
+    }
+}
+
+size_t gt_combine_hash(size_t h, size_t v){
+    return gt_mix_hash(h ^ (v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2)));
+}
+
+//////////////////////////////// END OF SUBTREE HASH HELPERS ////////////////////////////////
+
+
+//////////////////////////////// MEMORY ACCOUNTING HELPERS ////////////////////////////////
+
+/**
+ * @brief Returns the number of bytes held by a child index.
+ */
+static inline size_t index_bytes(gt_child_index* index){
+    return index != NULL ? sizeof(gt_child_index) + index->cap * sizeof(gt_index_slot) : 0;
+}
+
+/**
+ * @brief Counts the array of children of a position that was just created by init_gt_pos.
+ */
+static inline void account_new_pos(gt_pos* pos, g_tree* tree){
+    tree->mem.child_slots += pos->num_children_cap;
+    ++tree->mem.num_heap_arrays;
+}
+
+/**
+ * @brief Uncounts a position, its array of children and its child index before they are
+ * freed.
+ */
+static void account_freed_pos(gt_pos* pos, g_tree* tree){
+
+    tree->mem.child_slots -= pos->num_children_cap;
+    tree->mem.index_bytes -= index_bytes(pos->index);
+    if(pos->index != NULL)
+        --tree->mem.num_indexes;
+
+    if(pos->flags & GT_CHILDREN_IN_ARENA)
+        tree->mem.arena_slots_live -= pos->num_children_cap;
+    else if(pos->children != NULL)
+        --tree->mem.num_heap_arrays;
+
+    if(pos->flags & GT_POS_IN_ARENA)
+        --tree->mem.arena_nodes_live;
+}
+
+/**
+ * @brief Counts a tree whose positions and arrays of children were all just placed in one
+ * block of n positions and one block of n - 1 children slots.
+ */
+static void account_arena_tree(g_tree* tree, unsigned int n){
+    tree->mem.child_slots = n - 1;
+    tree->mem.num_heap_arrays = 0;
+    tree->mem.arena_nodes = tree->mem.arena_nodes_live = n;
+    tree->mem.arena_slots = tree->mem.arena_slots_live = n - 1;
+}
+
+//////////////////////////////// END OF MEMORY ACCOUNTING HELPERS ////////////////////////////////
+
+
+//////////////////////////////// RESIZING HELPERS ////////////////////////////////
+
+/**
+ * @brief Resizes the array of children of a position to new_cap slots, which must hold all
+ * its children, following the tree's growth policy and keeping the memory counters.
+ * @return true if the array was resized.
+ */
+static bool resize_children(gt_pos* pos, unsigned int new_cap, g_tree* tree){
+
+    unsigned int old_cap = pos->num_children_cap;
+    bool was_in_arena = pos->flags & GT_CHILDREN_IN_ARENA;
+    gt_pos** children;
+
+    if(new_cap == old_cap)
+        return true;
+
+    if(new_cap == 0){
+        children = NULL;
+        if(!was_in_arena)
+            free(pos->children);
+    }
+    else if(tree->policy.use_realloc && !was_in_arena && pos->children != NULL){
+        children = realloc(pos->children,new_cap * sizeof(gt_pos*));
+        if(children == NULL)
+            return false;
+    }
+    else{
+        children = malloc(new_cap * sizeof(gt_pos*));
+        if(children == NULL)
+            return false;
+        if(pos->num_children > 0)
+            memcpy(children,pos->children,pos->num_children * sizeof(gt_pos*));
+        if(!was_in_arena)
+            free(pos->children);
+    }
+
+    // the slots after the last child must be empty.
+    if(new_cap > pos->num_children)
+        memset(children + pos->num_children,0,(new_cap - pos->num_children) * sizeof(gt_pos*));
+
+    pos->children = children;
+    pos->num_children_cap = new_cap;
+    pos->flags &= ~GT_CHILDREN_IN_ARENA;
+
+    tree->mem.child_slots += (size_t) new_cap - old_cap;
+    if(was_in_arena)
+        tree->mem.arena_slots_live -= old_cap;
+    if((was_in_arena || old_cap == 0) && new_cap > 0)
+        ++tree->mem.num_heap_arrays;
+    else if(!was_in_arena && old_cap > 0 && new_cap == 0)
+        --tree->mem.num_heap_arrays;
+
+    if(new_cap > old_cap)
+        ++tree->mem.num_grows;
+    else
+        ++tree->mem.num_shrinks;
+
+    return true;
+}
+
+/**
+ * @brief Returns the capacity an array holding n children has right after growing.
+ */
+static unsigned int grown_capacity(unsigned int n, g_tree* tree){
+
+    unsigned int cap = (unsigned int) (n * tree->policy.growth_factor + 0.5f);
+
+    if(cap <= n)
+        cap = n + 1;
+
+    return cap > tree->policy.min_capacity ? cap : tree->policy.min_capacity;
+}
+
+/**
+ * @brief Shrinks the array of children of a position if its load fell below the policy's
+ * shrink load.
+ */
+static void shrink_children(gt_pos* pos, g_tree* tree){
+
+    float load = pos->num_children_cap > 0 ? (float) pos->num_children / pos->num_children_cap : 1.0f;
+
+    if(load >= tree->policy.shrink_load)
+        return;
+
+    // positions without children give their array back entirely.
+    unsigned int new_cap = pos->num_children > 0 ? grown_capacity(pos->num_children,tree) : 0;
+
+    if(new_cap < pos->num_children_cap)
+        resize_children(pos,new_cap,tree);
+}
+
+//////////////////////////////// END OF RESIZING HELPERS ////////////////////////////////
+
 
 g_tree* init_gt(){
     g_tree* new_tree = malloc(sizeof(g_tree));
     new_tree->root = NULL;
     new_tree->size = 0;
+    new_tree->handles = NULL;
+    new_tree->arenas = NULL;
+    new_tree->num_arenas = 0;
+    new_tree->key_hash = NULL;
+    new_tree->key_equals = NULL;
+    new_tree->index_threshold = 0;
+    new_tree->data_hash = NULL;
+    new_tree->policy = gt_default_growth_policy();
+    memset(&new_tree->mem,0,sizeof(gt_mem_counters));
     return new_tree;
 }
 
@@ -15,6 +349,12 @@ gt_pos* init_gt_pos(void* data_ptr){
         new_pos->data_ptr = data_ptr;
         new_pos->parent = NULL;
         new_pos->next_slot = 0;
+        new_pos->index_in_parent = 0;
+        new_pos->num_children = 0;
+        new_pos->handle = H_NULL;
+        new_pos->flags = 0;
+        new_pos->index = NULL;
+        new_pos->subtree_hash = 0;
         new_pos->children = calloc(new_pos->num_children_cap,sizeof(gt_pos*));
         for(int i=0; i<new_pos->num_children_cap; ++i)
             new_pos->children[i] = NULL;
@@ -26,12 +366,13 @@ gt_pos* init_gt_pos(void* data_ptr){
 
 gt_pos* expand_gt_pos(gt_pos* pos){
     
-    if(pos != NULL && is_internal(pos)){
+    if(pos != NULL){
 
         if(is_expandable(pos)){
 
             gt_pos** temp = pos->children;
-            pos->children = calloc(pos->num_children_cap * 2,sizeof(gt_pos*));
+            unsigned int new_cap = pos->num_children_cap > 0 ? pos->num_children_cap * 2 : DEFAULT_NUM_CHILDREN;
+            pos->children = calloc(new_cap,sizeof(gt_pos*));
 
             // copy the current children into the new array.
             for(int i=0; i<pos->num_children; ++i){
@@ -43,10 +384,13 @@ gt_pos* expand_gt_pos(gt_pos* pos){
             }
 
             // update the capacity to the new capacity.
-            pos->num_children_cap = pos->num_children_cap * 2;
+            pos->num_children_cap = new_cap;
             
             // deallocate the old array of pointers to the children of this position.
-            free(temp);
+            if(pos->flags & GT_CHILDREN_IN_ARENA)
+                pos->flags &= ~GT_CHILDREN_IN_ARENA;
+            else
+                free(temp);
             temp = NULL;
 
             return pos;
@@ -82,7 +426,10 @@ gt_pos* shrink_gt_pos(gt_pos* pos){
             // update the capacity
             pos->num_children_cap = pos->num_children_cap/2;
             // free the memory allocated to the old array of pointers.
-            free(tmp);
+            if(pos->flags & GT_CHILDREN_IN_ARENA)
+                pos->flags &= ~GT_CHILDREN_IN_ARENA;
+            else
+                free(tmp);
             tmp = NULL;
             return pos;
         }
@@ -107,11 +454,24 @@ gt_pos* free_gt_pos(gt_pos* pos, g_tree* tree){
                 fprintf(stderr,"%s\n","Failed to unlink the child position from its parent.");
         }
         
+        // release the handles of the position and its children.
+        if(tree->handles != NULL){
+            h_release(tree->handles,pos->handle);
+            pos->handle = H_NULL;
+
+            for(int i=0; i<pos->num_children; ++i)
+                h_release(tree->handles,pos->children[i]->handle);
+        }
+
+        pos->index = index_destroy(pos->index);
+
         // delete its children.
         if(is_internal(pos)){
 
             for(int i=0; i<pos->num_children; ++i){
-                free(pos->children[i]);
+                pos->children[i]->index = index_destroy(pos->children[i]->index);
+                if(!(pos->children[i]->flags & GT_POS_IN_ARENA))
+                    free(pos->children[i]);
                 pos->children[i] = NULL;
             }
         }
@@ -139,18 +499,28 @@ bool unlink_gt_pos_child(gt_pos* parent, gt_pos* child){
         bool is_unlinked = false;
         int index = -1;
 
-        for(int i=0; i<parent->num_children; ++i){
-            if(parent->children[i] == child){
-                parent->children[i] = NULL;
-                --parent->num_children;
-                is_unlinked = true;
-                index = i;
-                break;
-            }                
+        // the child's stored index finds it directly; scan only if it is not a child.
+        unsigned int i = child->index_in_parent;
+
+        if(i >= parent->num_children || parent->children[i] != child){
+            for(i=0; i<parent->num_children && parent->children[i] != child; ++i);
+        }
+
+        if(i < parent->num_children){
+            if(parent->index != NULL)
+                index_remove(parent->index,child);
+            parent->children[i] = NULL;
+            --parent->num_children;
+            is_unlinked = true;
+            index = i;
         }
 
         if(is_unlinked){
             shift_back(parent,index);
+            --parent->next_slot;
+            for(unsigned int j=index; j<parent->num_children; ++j)
+                parent->children[j]->index_in_parent = j;
+            invalidate_hashes(parent);
         }
 
         return is_unlinked;
@@ -171,7 +541,7 @@ void shift_back(gt_pos* pos, int start_index){
      
     if(pos != NULL && start_index >= 0 && pos->num_children > 0){
 
-        for(int i=start_index; i<pos->num_children_cap; ++i){
+        for(int i=start_index; i+1<pos->num_children_cap; ++i){
             if(pos->children[i] == NULL){
                 pos->children[i] = pos->children[i+1];
                 pos->children[i+1] = NULL;
@@ -202,7 +572,17 @@ bool has_root(g_tree* tree){
 gt_pos* add_gt_root(g_tree* tree, void* data){
 
     if(tree != NULL && !has_root(tree) && data != NULL){
-        tree->root = init_gt_pos(data);
+        gt_pos* new_pos = init_gt_pos(data);
+
+        // a position without the handle the table promises is not added.
+        if(tree->handles != NULL && (new_pos->handle = h_alloc(tree->handles,new_pos)) == H_NULL){
+            free(new_pos->children);
+            free(new_pos);
+            return NULL;
+        }
+
+        tree->root = new_pos;
+        account_new_pos(tree->root,tree);
         ++tree->size;
         return tree->root;
     }
@@ -210,22 +590,65 @@ gt_pos* add_gt_root(g_tree* tree, void* data){
     return NULL;
 }
 
+/**
+ * @brief Stores a position in the next slot of a parent's array of children, expanding the
+ * array first if needed, and updates the parent's child index and subtree hashes.
+ * @return true if the position was linked.
+ */
+static bool link_gt_child(gt_pos* child, gt_pos* parent, g_tree* tree){
+
+    if(is_expandable(parent) && !resize_children(parent,grown_capacity(parent->num_children_cap,tree),tree))
+        return false;
+
+    if(get_next_slot(parent) >= 0 && get_next_slot(parent) < parent->num_children_cap && parent->children[get_next_slot(parent)] == NULL){
+        parent->children[get_next_slot(parent)] = child;
+        child->parent = parent;
+        child->index_in_parent = parent->next_slot;
+        ++parent->next_slot;
+        ++parent->num_children;
+
+        invalidate_hashes(parent);
+
+        // keep the child index of a wide parent up to date.
+        size_t old_index_bytes = index_bytes(parent->index);
+
+        // an index that cannot take the child is dropped, so lookups scan the children.
+        if(parent->index != NULL){
+            if(!index_insert(parent->index,child)){
+                parent->index = index_destroy(parent->index);
+                --tree->mem.num_indexes;
+            }
+        }
+        else if(tree->index_threshold > 0 && parent->num_children > tree->index_threshold){
+            parent->index = index_build(parent,tree);
+            if(parent->index != NULL)
+                ++tree->mem.num_indexes;
+        }
+
+        tree->mem.index_bytes += index_bytes(parent->index) - old_index_bytes;
+        return true;
+    }
+
+    return false;
+}
+
 gt_pos* add_gt_child(void* data, gt_pos* parent, g_tree* tree){
 
     if(data != NULL && parent != NULL && tree != NULL){
 
-        if(is_expandable(parent))
-            parent = expand_gt_pos(parent);                    
-
         gt_pos* new_pos = init_gt_pos(data);
-        new_pos->parent = parent;
-        if(get_next_slot(parent) >= 0 && get_next_slot(parent) < parent->num_children_cap && parent->children[get_next_slot(parent)] == NULL){
-            parent->children[get_next_slot(parent)] = new_pos;   // CONTINUE HERE..
-            ++parent->next_slot;
+        bool has_handle = tree->handles == NULL || (new_pos->handle = h_alloc(tree->handles,new_pos)) != H_NULL;
+
+        if(has_handle && link_gt_child(new_pos,parent,tree)){
+            account_new_pos(new_pos,tree);
             ++tree->size;
-            ++parent->num_children;
             return new_pos;
         }
+
+        if(tree->handles != NULL)
+            h_release(tree->handles,new_pos->handle);
+        free(new_pos->children);
+        free(new_pos);
     }
 
     return NULL;
@@ -235,16 +658,222 @@ unsigned int get_size(g_tree* tree){
     return tree != NULL ? tree->size : 0;
 }
 
+/**
+ * @brief Frees positions in post-order, using the parent links instead of a stack, and
+ * releases their handles and child indexes. The walk starts at *cursor and ends when it
+ * climbs to "stop", or after "budget" positions were freed; *cursor is then left at the
+ * position to resume from, or at "stop" once the walk is over.
+ * @return the number of positions freed.
+ */
+static unsigned int free_positions(gt_pos** cursor, gt_pos* stop, unsigned int budget, g_tree* tree){
+
+    unsigned int count = 0;
+    gt_pos* pos = *cursor;
+
+    while(pos != stop && count < budget){
+
+        if(pos->num_children > 0){
+            pos = pos->children[--pos->num_children];
+            continue;
+        }
+
+        gt_pos* parent = pos->parent;
+
+        if(tree->handles != NULL)
+            h_release(tree->handles,pos->handle);
+        account_freed_pos(pos,tree);
+        index_destroy(pos->index);
+        if(!(pos->flags & GT_CHILDREN_IN_ARENA))
+            free(pos->children);
+        if(!(pos->flags & GT_POS_IN_ARENA))
+            free(pos);
+
+        ++count;
+        pos = parent;
+    }
+
+    *cursor = pos;
+    return count;
+}
+
+/**
+ * @brief Frees the positions of the subtree rooted at pos. The subtree must already be
+ * unlinked from its parent, or be the whole tree.
+ * @return the number of positions freed.
+ */
+static unsigned int free_subtree(gt_pos* pos, g_tree* tree){
+
+    gt_pos* stop = pos != NULL ? pos->parent : NULL;
+    return free_positions(&pos,stop,UINT_MAX,tree);
+}
+
 g_tree* delete_gt(g_tree* tree){
+
+    // a single step without a limit deletes the whole tree.
+    gt_destroy_step(tree,UINT_MAX);
     return NULL;
 }
 
+bool gt_destroy_step(g_tree* tree, unsigned int max_nodes){
+
+    if(tree == NULL)
+        return true;
+
+    // a budget of 0 still makes progress, so that a loop of steps always ends.
+    if(max_nodes == 0)
+        max_nodes = 1;
+
+    // between steps the root field holds the position the walk resumes from.
+    if(tree->root != NULL){
+        tree->size -= free_positions(&tree->root,NULL,max_nodes,tree);
+        if(tree->root != NULL)
+            return false;
+    }
+
+    for(unsigned int i=0; i<tree->num_arenas; ++i)
+        free(tree->arenas[i]);
+
+    free(tree->arenas);
+    destroy_h_table(tree->handles);
+    free(tree);
+    return true;
+}
+
+/**
+ * @brief Records a block allocated in bulk for the tree, so that "delete_gt" frees it.
+ * @return true if the block was recorded.
+ */
+static bool add_gt_arena(g_tree* tree, void* block){
+
+    void** arenas = realloc(tree->arenas,(tree->num_arenas + 1) * sizeof(void*));
+
+    if(arenas == NULL)
+        return false;
+
+    arenas[tree->num_arenas++] = block;
+    tree->arenas = arenas;
+    return true;
+}
+
+g_tree* gt_build_from_parents(void** data, const long* parents, unsigned int n){
+
+    if(data == NULL || parents == NULL || n == 0)
+        return NULL;
+
+    // find the root and check that every parent index is in range.
+    long root = -1;
+    for(unsigned int i=0; i<n; ++i){
+        if(parents[i] == -1){
+            if(root != -1)
+                return NULL;
+            root = i;
+        }
+        else if(parents[i] < 0 || parents[i] >= (long) n || parents[i] == (long) i)
+            return NULL;
+    }
+
+    if(root == -1)
+        return NULL;
+
+    g_tree* tree = init_gt();
+    gt_pos* nodes = malloc(n * sizeof(gt_pos));
+    gt_pos** children = n > 1 ? malloc((n - 1) * sizeof(gt_pos*)) : NULL;
+
+    if(tree == NULL || nodes == NULL || (n > 1 && children == NULL) || !add_gt_arena(tree,nodes) || (children != NULL && !add_gt_arena(tree,children))){
+        free(nodes);
+        free(children);
+        if(tree != NULL)
+            free(tree->arenas);
+        free(tree);
+        return NULL;
+    }
+
+    // first pass: initialize the positions and count the children of each.
+    for(unsigned int i=0; i<n; ++i){
+        nodes[i].data_ptr = data[i];
+        nodes[i].parent = parents[i] >= 0 ? &nodes[parents[i]] : NULL;
+        nodes[i].children = NULL;
+        nodes[i].num_children = 0;
+        nodes[i].num_children_cap = 0;
+        nodes[i].next_slot = 0;
+        nodes[i].index_in_parent = 0;
+        nodes[i].handle = H_NULL;
+        nodes[i].flags = GT_POS_IN_ARENA;
+        nodes[i].index = NULL;
+        nodes[i].subtree_hash = 0;
+    }
+
+    for(unsigned int i=0; i<n; ++i){
+        if(parents[i] >= 0)
+            ++nodes[parents[i]].num_children;
+    }
+
+    // carve the children block into arrays of exactly the right size.
+    gt_pos** next_array = children;
+    for(unsigned int i=0; i<n; ++i){
+        if(nodes[i].num_children > 0){
+            nodes[i].children = next_array;
+            nodes[i].num_children_cap = nodes[i].num_children;
+            nodes[i].flags |= GT_CHILDREN_IN_ARENA;
+            next_array += nodes[i].num_children;
+        }
+    }
+
+    // second pass: link every position into its parent's array, in index order.
+    for(unsigned int i=0; i<n; ++i){
+        if(parents[i] >= 0){
+            gt_pos* parent = &nodes[parents[i]];
+            nodes[i].index_in_parent = parent->next_slot;
+            parent->children[parent->next_slot++] = &nodes[i];
+        }
+    }
+
+    // positions on a cycle of parents are not reached from the root, so a walk from the
+    // root that misses any position means the arrays do not describe a tree.
+    unsigned int reached = 0;
+    gt_pos* pos = &nodes[root];
+
+    for(;;){
+
+        ++reached;
+
+        if(pos->num_children > 0){
+            pos = pos->children[0];
+            continue;
+        }
+
+        while(pos != &nodes[root] && pos->index_in_parent + 1 == pos->parent->num_children)
+            pos = pos->parent;
+
+        if(pos == &nodes[root])
+            break;
+
+        pos = pos->parent->children[pos->index_in_parent + 1];
+    }
+
+    if(reached != n){
+        free(nodes);
+        free(children);
+        free(tree->arenas);
+        free(tree);
+        return NULL;
+    }
+
+    tree->root = &nodes[root];
+    tree->size = n;
+    account_arena_tree(tree,n);
+    return tree;
+}
+
 int get_next_slot(gt_pos* pos){
     return (pos != NULL) ? pos->next_slot : -1;
 }
 
 bool is_expandable(gt_pos* pos){
     
+    if(pos != NULL && pos->num_children_cap == 0)
+        return true;
+
     if(pos != NULL && is_internal(pos)){
 
         float num_children = pos->num_children;
@@ -284,4 +913,988 @@ void gt_pos_str_print(gt_pos* pos){
     else
         printf("%s\n","General tree position has no children.");
 
-}
\ No newline at end of file
+}
+
+bool gt_enable_handles(g_tree* tree){
+
+    if(tree == NULL)
+        return false;
+
+    if(tree->handles != NULL)
+        return true;
+
+    tree->handles = init_h_table();
+
+    if(tree->handles == NULL)
+        return false;
+
+    if(has_root(tree)){
+
+        // issue handles to the existing positions, in depth-first order.
+        gt_pos** stack = malloc(get_size(tree) * sizeof(gt_pos*));
+        unsigned int top = 0;
+
+        if(stack == NULL){
+            tree->handles = destroy_h_table(tree->handles);
+            return false;
+        }
+
+        bool failed = false;
+        stack[top++] = get_root(tree);
+
+        while(top > 0){
+            gt_pos* pos = stack[--top];
+
+            if(!failed && (pos->handle = h_alloc(tree->handles,pos)) == H_NULL)
+                failed = true;
+
+            for(unsigned int i=0; i<pos->num_children; ++i)
+                stack[top++] = pos->children[i];
+        }
+
+        // without a handle for every position, the table is dropped and no position keeps one.
+        if(failed){
+            stack[top++] = get_root(tree);
+
+            while(top > 0){
+                gt_pos* pos = stack[--top];
+                pos->handle = H_NULL;
+
+                for(unsigned int i=0; i<pos->num_children; ++i)
+                    stack[top++] = pos->children[i];
+            }
+
+            free(stack);
+            tree->handles = destroy_h_table(tree->handles);
+            return false;
+        }
+
+        free(stack);
+    }
+
+    return true;
+}
+
+h_handle gt_get_handle(gt_pos* pos){
+    return pos != NULL ? pos->handle : H_NULL;
+}
+
+gt_pos* gt_h_resolve(h_handle handle, g_tree* tree){
+    return tree != NULL ? h_resolve(tree->handles,handle) : NULL;
+}
+
+h_handle gt_h_add_child(void* data, h_handle parent, g_tree* tree){
+
+    gt_pos* parent_pos = gt_h_resolve(parent,tree);
+
+    if(parent_pos == NULL)
+        return H_NULL;
+
+    return gt_get_handle(add_gt_child(data,parent_pos,tree));
+}
+
+bool gt_enable_path_index(g_tree* tree, gt_key_hash hash, gt_key_equals equals, unsigned int threshold){
+
+    if(tree == NULL || hash == NULL || equals == NULL || threshold == 0 || tree->index_threshold > 0)
+        return false;
+
+    tree->key_hash = hash;
+    tree->key_equals = equals;
+    tree->index_threshold = threshold;
+
+    if(has_root(tree)){
+
+        // index the positions that are already wide, in depth-first order.
+        gt_pos** stack = malloc(get_size(tree) * sizeof(gt_pos*));
+        unsigned int top = 0;
+
+        if(stack == NULL)
+            return false;
+
+        stack[top++] = get_root(tree);
+
+        while(top > 0){
+            gt_pos* pos = stack[--top];
+
+            if(pos->index == NULL && pos->num_children > threshold){
+                pos->index = index_build(pos,tree);
+                tree->mem.index_bytes += index_bytes(pos->index);
+                if(pos->index != NULL)
+                    ++tree->mem.num_indexes;
+            }
+
+            for(unsigned int i=0; i<pos->num_children; ++i)
+                stack[top++] = pos->children[i];
+        }
+
+        free(stack);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Scans the children of a position for the one whose key equals "key", comparing
+ * with "equals" or, if it is null, by address.
+ */
+static gt_pos* scan_children(gt_pos* parent, void* key, gt_key_equals equals){
+
+    for(unsigned int i=0; i<parent->num_children; ++i){
+        void* data = parent->children[i]->data_ptr;
+        if(equals != NULL ? equals(data,key) : data == key)
+            return parent->children[i];
+    }
+
+    return NULL;
+}
+
+gt_pos* gt_find_child(gt_pos* parent, void* key, g_tree* tree){
+
+    if(parent == NULL || key == NULL || tree == NULL)
+        return NULL;
+
+    if(parent->index != NULL){
+        long slot = index_find(parent->index,key,gt_mix_hash(parent->index->hash(key)));
+        return slot >= 0 ? parent->index->slots[slot].child : NULL;
+    }
+
+    return scan_children(parent,key,tree->key_equals);
+}
+
+/**
+ * @brief Cuts the next key off a path that is being resolved in place, by replacing the
+ * separator after it with a terminator.
+ * @param cursor A pointer to the unresolved rest of the path, advanced past the key.
+ * @return the key, or null if the path has no keys left.
+ */
+static char* next_path_key(char** cursor){
+
+    char* key = *cursor;
+
+    while(*key == '/')
+        ++key;
+
+    if(*key == '\0')
+        return NULL;
+
+    char* end = key;
+    while(*end != '\0' && *end != '/')
+        ++end;
+
+    *cursor = *end == '\0' ? end : end + 1;
+    *end = '\0';
+    return key;
+}
+
+gt_pos* gt_resolve_path(g_tree* tree, const char* path){
+
+    gt_pos* out = NULL;
+    gt_resolve_paths(tree,&path,1,&out);
+    return out;
+}
+
+unsigned int gt_resolve_paths(g_tree* tree, const char** paths, unsigned int n, gt_pos** out){
+
+    if(tree == NULL || paths == NULL || out == NULL)
+        return 0;
+
+    unsigned int resolved = 0;
+
+    for(unsigned int start=0; start<n; start+=GT_RESOLVE_GROUP){
+
+        unsigned int group = n - start < GT_RESOLVE_GROUP ? n - start : GT_RESOLVE_GROUP;
+        char* copies[GT_RESOLVE_GROUP];
+        char* cursors[GT_RESOLVE_GROUP];
+        char* keys[GT_RESOLVE_GROUP];
+        size_t hashes[GT_RESOLVE_GROUP];
+        gt_pos** curr = out + start;
+        unsigned int active = 0;
+
+        // the keys are cut out of a private copy of every path.
+        for(unsigned int i=0; i<group; ++i){
+
+            const char* path = paths[start + i] != NULL ? paths[start + i] : "";
+            copies[i] = cursors[i] = malloc(strlen(path) + 1);
+            curr[i] = NULL;
+
+            if(copies[i] != NULL && has_root(tree)){
+                strcpy(copies[i],path);
+                curr[i] = get_root(tree);
+                ++active;
+            }
+        }
+
+        // advance every unfinished lookup by one level per round.
+        while(active > 0){
+
+            // first, hash each next key and prefetch what the lookup is going to read.
+            for(unsigned int i=0; i<group; ++i){
+
+                if(curr[i] == NULL || cursors[i] == NULL)
+                    continue;
+
+                keys[i] = next_path_key(&cursors[i]);
+
+                if(keys[i] == NULL){
+                    cursors[i] = NULL;
+                    --active;
+                    continue;
+                }
+
+                gt_child_index* index = curr[i]->index;
+                if(index != NULL){
+                    hashes[i] = gt_mix_hash(index->hash(keys[i]));
+                    __builtin_prefetch(&index->slots[hashes[i] & (index->cap - 1)]);
+                }
+                else
+                    __builtin_prefetch(curr[i]->children);
+            }
+
+            // then, step each lookup down to the matching child.
+            for(unsigned int i=0; i<group; ++i){
+
+                if(curr[i] == NULL || cursors[i] == NULL)
+                    continue;
+
+                gt_child_index* index = curr[i]->index;
+                if(index != NULL){
+                    long slot = index_find(index,keys[i],hashes[i]);
+                    curr[i] = slot >= 0 ? index->slots[slot].child : NULL;
+                }
+                else
+                    curr[i] = scan_children(curr[i],keys[i],tree->key_equals != NULL ? tree->key_equals : gt_str_equals);
+
+                if(curr[i] == NULL)
+                    --active;
+            }
+        }
+
+        for(unsigned int i=0; i<group; ++i){
+            free(copies[i]);
+            if(curr[i] != NULL)
+                ++resolved;
+        }
+    }
+
+    return resolved;
+}
+
+size_t gt_str_hash(void* data){
+    return (size_t) fnv_hash(FNV_OFFSET_BASIS,data,strlen(data));
+}
+
+bool gt_str_equals(void* data_a, void* data_b){
+    return strcmp((char*) data_a,(char*) data_b) == 0;
+}
+
+gt_pos* remove_gt_pos(gt_pos* pos, g_tree* tree){
+
+    if(pos == NULL || tree == NULL)
+        return NULL;
+
+    if(is_root(pos,tree)){
+        free_subtree(pos,tree);
+        tree->root = NULL;
+        tree->size = 0;
+        return NULL;
+    }
+
+    gt_pos* parent = pos->parent;
+
+    if(unlink_gt_pos_child(parent,pos)){
+        tree->size -= free_subtree(pos,tree);
+        if(!tree->policy.lazy_shrink)
+            shrink_children(parent,tree);
+    }
+
+    return NULL;
+}
+
+gt_pos* gt_insert_child_at(void* data, gt_pos* parent, unsigned int index, g_tree* tree){
+
+    if(parent == NULL || index > parent->num_children)
+        return NULL;
+
+    gt_pos* new_pos = add_gt_child(data,parent,tree);
+
+    if(new_pos != NULL){
+        // rotate the new last child into place.
+        memmove(parent->children + index + 1,parent->children + index,(parent->num_children - 1 - index) * sizeof(gt_pos*));
+        parent->children[index] = new_pos;
+        for(unsigned int i=index; i<parent->num_children; ++i)
+            parent->children[i]->index_in_parent = i;
+    }
+
+    return new_pos;
+}
+
+/**
+ * @brief Puts a position that was just unlinked from a parent back at its former index. The
+ * parent's array still has the slot it left, since unlinking does not shrink the array.
+ */
+static void relink_gt_child_at(gt_pos* child, gt_pos* parent, unsigned int index, g_tree* tree){
+
+    memmove(parent->children + index + 1,parent->children + index,(parent->num_children - index) * sizeof(gt_pos*));
+    parent->children[index] = child;
+    child->parent = parent;
+    ++parent->num_children;
+    ++parent->next_slot;
+
+    for(unsigned int i=index; i<parent->num_children; ++i)
+        parent->children[i]->index_in_parent = i;
+
+    size_t old_index_bytes = index_bytes(parent->index);
+
+    if(parent->index != NULL && !index_insert(parent->index,child)){
+        parent->index = index_destroy(parent->index);
+        --tree->mem.num_indexes;
+    }
+
+    tree->mem.index_bytes += index_bytes(parent->index) - old_index_bytes;
+    invalidate_hashes(parent);
+}
+
+bool gt_move_subtree(gt_pos* pos, gt_pos* new_parent, g_tree* tree){
+
+    if(pos == NULL || new_parent == NULL || tree == NULL || is_root(pos,tree))
+        return false;
+
+    // a subtree cannot be moved below itself.
+    for(gt_pos* ancestor = new_parent; ancestor != NULL; ancestor = ancestor->parent){
+        if(ancestor == pos)
+            return false;
+    }
+
+    gt_pos* old_parent = pos->parent;
+    unsigned int old_index = pos->index_in_parent;
+
+    if(!unlink_gt_pos_child(old_parent,pos))
+        return false;
+
+    if(!link_gt_child(pos,new_parent,tree)){
+        // put the subtree back where it was, between the same siblings.
+        relink_gt_child_at(pos,old_parent,old_index,tree);
+        return false;
+    }
+
+    if(!tree->policy.lazy_shrink)
+        shrink_children(old_parent,tree);
+
+    return true;
+}
+
+void* gt_replace(gt_pos* pos, void* data, g_tree* tree){
+
+    if(pos == NULL || tree == NULL)
+        return NULL;
+
+    void* old_data = pos->data_ptr;
+    gt_child_index* index = pos->parent != NULL ? pos->parent->index : NULL;
+
+    size_t old_index_bytes = index_bytes(index);
+
+    // the key of the position changes, so it is re-filed in its parent's index.
+    if(index != NULL)
+        index_remove(index,pos);
+
+    pos->data_ptr = data;
+
+    if(index != NULL && !index_insert(index,pos)){
+        pos->parent->index = index = index_destroy(index);
+        --tree->mem.num_indexes;
+    }
+
+    tree->mem.index_bytes += index_bytes(index) - old_index_bytes;
+
+    invalidate_hashes(pos);
+    return old_data;
+}
+
+bool gt_set_data_hash(g_tree* tree, gt_key_hash hash){
+
+    if(tree == NULL || hash == NULL)
+        return false;
+
+    if(tree->data_hash != hash && has_root(tree)){
+
+        // discard the hashes computed with the previous function.
+        gt_pos** stack = malloc(get_size(tree) * sizeof(gt_pos*));
+        unsigned int top = 0;
+
+        if(stack == NULL)
+            return false;
+
+        stack[top++] = get_root(tree);
+
+        while(top > 0){
+            gt_pos* pos = stack[--top];
+            pos->subtree_hash = 0;
+            for(unsigned int i=0; i<pos->num_children; ++i)
+                stack[top++] = pos->children[i];
+        }
+
+        free(stack);
+    }
+
+    tree->data_hash = hash;
+    return true;
+}
+
+size_t gt_subtree_hash(gt_pos* pos, g_tree* tree){
+
+    if(pos == NULL || tree == NULL || tree->data_hash == NULL)
+        return 0;
+
+    if(pos->subtree_hash != 0)
+        return pos->subtree_hash;
+
+    // collect the positions without a cached hash in pre-order; positions with a cached
+    // hash have cached hashes throughout their subtrees.
+    unsigned int cap = 64;
+    unsigned int top = 0;
+    unsigned int count = 0;
+    gt_pos** stack = malloc(cap * sizeof(gt_pos*));
+    gt_pos** order = malloc(cap * sizeof(gt_pos*));
+
+    if(stack == NULL || order == NULL){
+        free(stack);
+        free(order);
+        return 0;
+    }
+
+    stack[top++] = pos;
+
+    while(top > 0){
+
+        gt_pos* curr = stack[--top];
+
+        if(count == cap || top + curr->num_children > cap){
+            while(cap <= count || cap < top + curr->num_children)
+                cap *= 2;
+            gt_pos** grown_stack = realloc(stack,cap * sizeof(gt_pos*));
+            gt_pos** grown_order = grown_stack != NULL ? realloc(order,cap * sizeof(gt_pos*)) : NULL;
+            if(grown_stack != NULL)
+                stack = grown_stack;
+            if(grown_order == NULL){
+                free(stack);
+                free(order);
+                return 0;
+            }
+            order = grown_order;
+        }
+
+        order[count++] = curr;
+
+        for(unsigned int i=0; i<curr->num_children; ++i){
+            if(curr->children[i]->subtree_hash == 0)
+                stack[top++] = curr->children[i];
+        }
+    }
+
+    // in reverse pre-order every position comes after all its descendants.
+    while(count > 0){
+
+        gt_pos* curr = order[--count];
+        size_t h = gt_combine_hash(gt_mix_hash(tree->data_hash(curr->data_ptr)),curr->num_children);
+
+        for(unsigned int i=0; i<curr->num_children; ++i)
+            h = gt_combine_hash(h,curr->children[i]->subtree_hash);
+
+        curr->subtree_hash = h != 0 ? h : 1;
+    }
+
+    free(stack);
+    free(order);
+    return pos->subtree_hash;
+}
+
+g_tree* gt_clone(g_tree* tree){
+
+    if(tree == NULL)
+        return NULL;
+
+    g_tree* copy = init_gt();
+
+    if(copy == NULL)
+        return NULL;
+
+    // the copy's arrays of children grow and shrink like the original's.
+    copy->policy = tree->policy;
+
+    if(!has_root(tree))
+        return copy;
+
+    unsigned int n = get_size(tree);
+    gt_pos** sources = malloc(n * sizeof(gt_pos*));
+    gt_pos* nodes = malloc(n * sizeof(gt_pos));
+    gt_pos** children = n > 1 ? malloc((n - 1) * sizeof(gt_pos*)) : NULL;
+
+    if(sources == NULL || nodes == NULL || (n > 1 && children == NULL) || !add_gt_arena(copy,nodes) || (children != NULL && !add_gt_arena(copy,children))){
+        free(sources);
+        free(nodes);
+        free(children);
+        free(copy->arenas);
+        free(copy);
+        return NULL;
+    }
+
+    // copy the positions breadth first, using the block of copies as the queue.
+    unsigned int tail = 1;
+    gt_pos** next_array = children;
+    sources[0] = get_root(tree);
+
+    for(unsigned int i=0; i<tail; ++i){
+
+        gt_pos* src = sources[i];
+        gt_pos* dst = &nodes[i];
+
+        // the parent link of a copy was set when its parent was copied; the root has none.
+        gt_pos* parent = i == 0 ? NULL : dst->parent;
+
+        *dst = *src;
+        dst->parent = parent;
+        dst->children = NULL;
+        dst->num_children_cap = src->num_children;
+        dst->next_slot = src->num_children;
+        dst->handle = H_NULL;
+        dst->flags = GT_POS_IN_ARENA;
+        dst->index = NULL;
+
+        if(src->num_children > 0){
+            dst->children = next_array;
+            dst->flags |= GT_CHILDREN_IN_ARENA;
+            next_array += src->num_children;
+        }
+
+        for(unsigned int c=0; c<src->num_children; ++c){
+            sources[tail] = src->children[c];
+            nodes[tail].parent = dst;
+            nodes[tail].index_in_parent = c;
+            dst->children[c] = &nodes[tail];
+            ++tail;
+        }
+    }
+
+    free(sources);
+
+    copy->root = &nodes[0];
+    copy->size = tail;
+    copy->data_hash = tree->data_hash;
+    account_arena_tree(copy,tail);
+
+    // the copy indexes its wide positions like the original does.
+    if(tree->key_hash != NULL)
+        gt_enable_path_index(copy,tree->key_hash,tree->key_equals,tree->index_threshold);
+
+    return copy;
+}
+
+/**
+ * @brief Returns the position that follows pos in a pre-order walk of the subtree rooted at
+ * start, without descending below depth "limit". "depth" is the depth of pos below start and
+ * is updated to the depth of the returned position.
+ */
+static gt_pos* walk_step(gt_pos* pos, unsigned int* depth, unsigned int limit, gt_pos* start){
+
+    if(*depth < limit && pos->num_children > 0){
+        ++*depth;
+        return pos->children[0];
+    }
+
+    // climb to the nearest ancestor, or pos itself, that has a next sibling.
+    while(pos != start && pos->index_in_parent + 1 >= pos->parent->num_children){
+        pos = pos->parent;
+        --*depth;
+    }
+
+    return pos != start ? pos->parent->children[pos->index_in_parent + 1] : NULL;
+}
+
+/**
+ * @brief Returns the first position at depth "target" below start that follows pos in
+ * pre-order, or null if there is none.
+ */
+static gt_pos* seek_depth(gt_pos* pos, unsigned int depth, unsigned int target, gt_pos* start){
+
+    while((pos = walk_step(pos,&depth,target,start)) != NULL){
+        if(depth == target)
+            return pos;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Appends a position to the queue of a breadth-first walk, doubling the ring buffer
+ * when it is full.
+ * @return true if the position was queued.
+ */
+static bool walk_push(gt_walk* walk, gt_pos* pos){
+
+    if(walk->queue_len == walk->queue_cap){
+
+        unsigned int cap = walk->queue_cap > 0 ? 2 * walk->queue_cap : 16;
+        gt_pos** queue = malloc(cap * sizeof(gt_pos*));
+
+        if(queue == NULL)
+            return false;
+
+        // unroll the ring into the front of the new buffer.
+        for(unsigned int i=0; i<walk->queue_len; ++i)
+            queue[i] = walk->queue[(walk->queue_head + i) % walk->queue_cap];
+
+        free(walk->queue);
+        walk->queue = queue;
+        walk->queue_head = 0;
+        walk->queue_cap = cap;
+    }
+
+    walk->queue[(walk->queue_head + walk->queue_len++) % walk->queue_cap] = pos;
+    return true;
+}
+
+/**
+ * @brief Removes and returns the first position of the queue of a breadth-first walk.
+ */
+static gt_pos* walk_pop(gt_walk* walk){
+
+    gt_pos* pos = walk->queue[walk->queue_head];
+    walk->queue_head = (walk->queue_head + 1) % walk->queue_cap;
+    --walk->queue_len;
+    return pos;
+}
+
+gt_walk gt_walk_begin(gt_pos* start, gt_walk_order order){
+
+    gt_walk walk = {start,start,order,NULL,0,0,0,false};
+    return walk;
+}
+
+void gt_walk_end(gt_walk* walk){
+
+    if(walk != NULL){
+        free(walk->queue);
+        walk->queue = NULL;
+        walk->queue_head = walk->queue_len = walk->queue_cap = 0;
+        walk->next = NULL;
+    }
+}
+
+gt_pos* gt_walk_next(gt_walk* walk){
+
+    if(walk == NULL || walk->next == NULL)
+        return NULL;
+
+    gt_pos* pos = walk->next;
+
+    if(walk->order == GT_WALK_PREORDER){
+        unsigned int depth = 0;
+        walk->next = walk_step(pos,&depth,UINT_MAX,walk->start);
+        return pos;
+    }
+
+    // the children of pos come after those of every position queued before it.
+    if(pos->num_children > 0 && !walk_push(walk,pos)){
+        walk->failed = true;
+        walk->next = NULL;
+        return pos;
+    }
+
+    // the next sibling, or else the first child of the next queued position.
+    if(pos != walk->start && pos->index_in_parent + 1 < pos->parent->num_children)
+        walk->next = pos->parent->children[pos->index_in_parent + 1];
+    else{
+        walk->next = NULL;
+        while(walk->next == NULL && walk->queue_len > 0){
+            gt_pos* parent = walk_pop(walk);
+            walk->next = parent->num_children > 0 ? parent->children[0] : NULL;
+        }
+    }
+
+    return pos;
+}
+
+unsigned int gt_walk_next_n(gt_walk* walk, gt_pos** out, unsigned int n){
+
+    if(walk == NULL || out == NULL)
+        return 0;
+
+    unsigned int count = 0;
+
+    while(count < n && walk->next != NULL)
+        out[count++] = gt_walk_next(walk);
+
+    return count;
+}
+
+bool gt_walk_save(gt_walk* walk, gt_walk_token* token){
+
+    if(walk == NULL || token == NULL || walk->start == NULL || walk->start->handle == H_NULL)
+        return false;
+
+    token->start = walk->start->handle;
+    token->next = walk->next != NULL ? walk->next->handle : H_NULL;
+    token->order = walk->order;
+    token->queue = NULL;
+    token->queue_len = walk->queue_len;
+
+    if(walk->queue_len > 0){
+
+        token->queue = malloc(walk->queue_len * sizeof(h_handle));
+
+        if(token->queue == NULL)
+            return false;
+
+        for(unsigned int i=0; i<walk->queue_len; ++i)
+            token->queue[i] = walk->queue[(walk->queue_head + i) % walk->queue_cap]->handle;
+    }
+
+    return true;
+}
+
+bool gt_walk_resume(gt_walk* walk, gt_walk_token token, g_tree* tree){
+
+    if(walk == NULL || tree == NULL)
+        return false;
+
+    gt_pos* start = gt_h_resolve(token.start,tree);
+    gt_pos* next = token.next != H_NULL ? gt_h_resolve(token.next,tree) : NULL;
+
+    if(start == NULL || (token.next != H_NULL && next == NULL))
+        return false;
+
+    // check that the next position is still in the subtree.
+    gt_pos* pos = next;
+
+    while(pos != NULL && pos != start)
+        pos = pos->parent;
+
+    if(next != NULL && pos == NULL)
+        return false;
+
+    gt_walk resumed = gt_walk_begin(start,token.order);
+    resumed.next = next;
+
+    for(unsigned int i=0; i<token.queue_len; ++i){
+
+        gt_pos* queued = gt_h_resolve(token.queue[i],tree);
+
+        if(queued == NULL || !walk_push(&resumed,queued)){
+            gt_walk_end(&resumed);
+            return false;
+        }
+    }
+
+    *walk = resumed;
+    return true;
+}
+
+void gt_walk_token_release(gt_walk_token* token){
+
+    if(token != NULL){
+        free(token->queue);
+        token->queue = NULL;
+        token->queue_len = 0;
+    }
+}
+
+/**
+ * @brief Appends to "order" the positions of the subtree rooted at pos that are less than
+ * "height" levels below it, in van Emde Boas order.
+ */
+static void veb_order(gt_pos* pos, unsigned int height, gt_pos** order, unsigned int* count){
+
+    if(height == 1){
+        order[(*count)++] = pos;
+        return;
+    }
+
+    unsigned int top = height / 2;
+
+    veb_order(pos,top,order,count);
+
+    // lay out the bottom subtrees hanging below the top part, left to right.
+    for(gt_pos* sub = seek_depth(pos,0,top,pos); sub != NULL; sub = seek_depth(sub,top,top,pos))
+        veb_order(sub,height - top,order,count);
+}
+
+bool gt_relayout(g_tree* tree, gt_layout layout, gt_remap func, void* ctx){
+
+    if(tree == NULL)
+        return false;
+
+    if(!has_root(tree))
+        return true;
+
+    unsigned int n = get_size(tree);
+    gt_pos** order = malloc(n * sizeof(gt_pos*));
+    gt_pos* nodes = malloc(n * sizeof(gt_pos));
+    gt_pos** children = n > 1 ? malloc((n - 1) * sizeof(gt_pos*)) : NULL;
+    void** arenas = malloc(2 * sizeof(void*));
+
+    if(order == NULL || nodes == NULL || (n > 1 && children == NULL) || arenas == NULL){
+        free(order);
+        free(nodes);
+        free(children);
+        free(arenas);
+        return false;
+    }
+
+    gt_pos* root = get_root(tree);
+    unsigned int count = 0;
+
+    if(layout == GT_LAYOUT_VEB){
+
+        // the height of the tree, from a pre-order walk that tracks the depth.
+        unsigned int depth = 0;
+        unsigned int height = 1;
+
+        for(gt_pos* pos = root; pos != NULL; pos = walk_step(pos,&depth,UINT_MAX,root)){
+            if(depth + 1 > height)
+                height = depth + 1;
+        }
+
+        veb_order(root,height,order,&count);
+    }
+    else{
+        // breadth first, using the order array as the queue.
+        order[count++] = root;
+        for(unsigned int i=0; i<count; ++i){
+            for(unsigned int c=0; c<order[i]->num_children; ++c)
+                order[count++] = order[i]->children[c];
+        }
+    }
+
+    // copy the positions, then leave each new address behind in the old position's parent
+    // link, which is no longer needed once every position is copied.
+    for(unsigned int i=0; i<n; ++i)
+        nodes[i] = *order[i];
+
+    for(unsigned int i=0; i<n; ++i){
+        order[i]->parent = &nodes[i];
+        if(func != NULL)
+            func(order[i],&nodes[i],ctx);
+    }
+
+    // link the copies through the forwarding addresses.
+    gt_pos** next_array = children;
+
+    for(unsigned int i=0; i<n; ++i){
+
+        gt_pos* pos = &nodes[i];
+        gt_pos** old_children = pos->children;
+
+        pos->parent = pos->parent != NULL ? pos->parent->parent : NULL;
+        pos->flags = GT_POS_IN_ARENA;
+        pos->num_children_cap = pos->num_children;
+        pos->next_slot = pos->num_children;
+        pos->children = NULL;
+
+        if(pos->num_children > 0){
+            pos->children = next_array;
+            pos->flags |= GT_CHILDREN_IN_ARENA;
+            next_array += pos->num_children;
+
+            for(unsigned int c=0; c<pos->num_children; ++c)
+                pos->children[c] = old_children[c]->parent;
+        }
+
+        if(pos->index != NULL){
+            for(unsigned int j=0; j<pos->index->cap; ++j){
+                gt_pos* child = pos->index->slots[j].child;
+                if(child != NULL && child != REMOVED_CHILD)
+                    pos->index->slots[j].child = child->parent;
+            }
+        }
+
+        if(tree->handles != NULL)
+            h_relocate(tree->handles,pos->handle,pos);
+    }
+
+    // free the old positions and arrays that were allocated one by one, then the blocks.
+    for(unsigned int i=0; i<n; ++i){
+        if(!(order[i]->flags & GT_CHILDREN_IN_ARENA))
+            free(order[i]->children);
+        if(!(order[i]->flags & GT_POS_IN_ARENA))
+            free(order[i]);
+    }
+
+    for(unsigned int i=0; i<tree->num_arenas; ++i)
+        free(tree->arenas[i]);
+    free(tree->arenas);
+
+    arenas[0] = nodes;
+    arenas[1] = children;
+    tree->arenas = arenas;
+    tree->num_arenas = children != NULL ? 2 : 1;
+    tree->root = &nodes[0];
+    account_arena_tree(tree,n);
+
+    free(order);
+    return true;
+}
+
+bool gt_memory_usage(g_tree* tree, gt_mem_usage* usage){
+
+    if(tree == NULL || usage == NULL)
+        return false;
+
+    gt_mem_counters* mem = &tree->mem;
+    unsigned int n = tree->size;
+    size_t used_slots = n > 0 ? n - 1 : 0;
+
+    usage->payload_bytes = n * sizeof(void*);
+    usage->node_overhead_bytes = n * (sizeof(gt_pos) - sizeof(void*));
+    usage->child_array_bytes = mem->child_slots * sizeof(gt_pos*);
+    usage->wasted_child_bytes = mem->child_slots > used_slots ? (mem->child_slots - used_slots) * sizeof(gt_pos*) : 0;
+    usage->index_bytes = mem->index_bytes;
+    usage->handle_bytes = tree->handles != NULL ? sizeof(h_table) + tree->handles->capacity * sizeof(h_slot) : 0;
+    usage->tree_bytes = sizeof(g_tree) + tree->num_arenas * sizeof(void*);
+    usage->dead_arena_bytes = (mem->arena_nodes - mem->arena_nodes_live) * sizeof(gt_pos) + (mem->arena_slots - mem->arena_slots_live) * sizeof(gt_pos*);
+
+    // the tree, the positions and arrays allocated one by one, the blocks and their list,
+    // the two allocations of every index and of the handle table.
+    usage->num_allocations = 1 + (n - mem->arena_nodes_live) + mem->num_heap_arrays + tree->num_arenas + (tree->num_arenas > 0 ? 1 : 0) + 2 * mem->num_indexes + (tree->handles != NULL ? 2 : 0);
+
+    usage->num_grows = mem->num_grows;
+    usage->num_shrinks = mem->num_shrinks;
+
+    usage->total_bytes = usage->payload_bytes + usage->node_overhead_bytes + usage->child_array_bytes + usage->index_bytes + usage->handle_bytes + usage->tree_bytes + usage->dead_arena_bytes;
+    return true;
+}
+
+gt_growth_policy gt_default_growth_policy(){
+
+    gt_growth_policy policy = {2.0f,0.0f,DEFAULT_NUM_CHILDREN,false,false};
+    return policy;
+}
+
+bool gt_set_growth_policy(g_tree* tree, gt_growth_policy policy){
+
+    // a shrunk array must stay below the load at which it grows again.
+    if(tree == NULL || policy.growth_factor <= 1.0f || policy.shrink_load < 0.0f || policy.shrink_load >= 0.8f / policy.growth_factor || policy.min_capacity == 0)
+        return false;
+
+    tree->policy = policy;
+    return true;
+}
+
+unsigned int gt_compact_children(g_tree* tree){
+
+    if(tree == NULL || !has_root(tree))
+        return 0;
+
+    unsigned long before = tree->mem.num_shrinks;
+    unsigned int depth = 0;
+    gt_pos* root = get_root(tree);
+
+    for(gt_pos* pos = root; pos != NULL; pos = walk_step(pos,&depth,UINT_MAX,root)){
+
+        if(tree->policy.shrink_load > 0.0f)
+            shrink_children(pos,tree);
+        else if(pos->num_children < pos->num_children_cap)
+            resize_children(pos,pos->num_children,tree);
+    }
+
+    return tree->mem.num_shrinks - before;
+}
@@ -0,0 +1,658 @@
+/**
+ * @brief This graph.c file contains the implementations of the functions that access and
+ * manipulate the "graph", "gr_vertex", "gr_edge" and "gr_csr" structs.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/graph.h"
+#include <pthread.h>
+#include <unistd.h>
+
+/// @brief The number of vertices of the current level a thread of the parallel BFS takes at
+/// a time.
+#define CSR_BFS_CHUNK 64
+
+/// @brief The number of discovered vertices a thread of the parallel BFS gathers before it
+/// appends them to the next level.
+#define CSR_BFS_BUFFER 256
+
+////////////////////// GRAPH FUNCTIONS //////////////////////
+
+graph* init_graph(bool directed){
+
+    graph* g = malloc(sizeof(graph));
+
+    if(g == NULL)
+        return NULL;
+
+    g->vertices = init_p_list();
+    g->edges = init_p_list();
+    g->directed = directed;
+
+    if(g->vertices == NULL || g->edges == NULL){
+        destroy_p_list(g->vertices);
+        destroy_p_list(g->edges);
+        free(g);
+        return NULL;
+    }
+
+    return g;
+}
+
+graph* destroy_graph(graph* g){
+
+    if(g != NULL){
+
+        for(pl_cursor cur = pl_cursor_begin(g->edges); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur))
+            free(pl_cursor_get(&cur));
+
+        for(pl_cursor cur = pl_cursor_begin(g->vertices); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur)){
+            gr_vertex* v = pl_cursor_get(&cur);
+            destroy_p_list(v->out);
+            destroy_p_list(v->in);
+            free(v);
+        }
+
+        destroy_p_list(g->edges);
+        destroy_p_list(g->vertices);
+        free(g);
+    }
+
+    return NULL;
+}
+
+uint gr_num_vertices(graph* g){
+    return (g != NULL) ? g->vertices->num_elements : 0;
+}
+
+uint gr_num_edges(graph* g){
+    return (g != NULL) ? g->edges->num_elements : 0;
+}
+
+gr_vertex* gr_insert_vertex(graph* g, void* data){
+
+    if(g == NULL)
+        return NULL;
+
+    gr_vertex* v = malloc(sizeof(gr_vertex));
+
+    if(v == NULL)
+        return NULL;
+
+    v->data_ptr = data;
+    v->out = init_p_list();
+    v->in = g->directed ? init_p_list() : NULL;
+    v->id = CSR_NONE;
+    v->pos = NULL;
+
+    if(v->out != NULL && (!g->directed || v->in != NULL))
+        v->pos = add_last(v,g->vertices);
+
+    if(v->pos == NULL){
+        destroy_p_list(v->out);
+        destroy_p_list(v->in);
+        free(v);
+        return NULL;
+    }
+
+    return v;
+}
+
+gr_edge* gr_insert_edge(graph* g, gr_vertex* origin, gr_vertex* dest, void* data){
+
+    if(g == NULL || origin == NULL || dest == NULL)
+        return NULL;
+
+    gr_edge* e = malloc(sizeof(gr_edge));
+
+    if(e == NULL)
+        return NULL;
+
+    e->data_ptr = data;
+    e->origin = origin;
+    e->dest = dest;
+    e->origin_pos = add_last(e,origin->out);
+    e->dest_pos = NULL;
+    e->pos = NULL;
+
+    // an undirected loop is listed once among the edges of its vertex.
+    if(g->directed)
+        e->dest_pos = add_last(e,dest->in);
+    else
+        e->dest_pos = origin == dest ? e->origin_pos : add_last(e,dest->out);
+
+    if(e->origin_pos != NULL && e->dest_pos != NULL)
+        e->pos = add_last(e,g->edges);
+
+    if(e->pos == NULL){
+        if(e->origin_pos != NULL)
+            delete(e->origin_pos,origin->out);
+        if(e->dest_pos != NULL && e->dest_pos != e->origin_pos)
+            delete(e->dest_pos,g->directed ? dest->in : dest->out);
+        free(e);
+        return NULL;
+    }
+
+    return e;
+}
+
+void* gr_remove_edge(graph* g, gr_edge* e){
+
+    if(g == NULL || e == NULL)
+        return NULL;
+
+    delete(e->origin_pos,e->origin->out);
+
+    if(g->directed)
+        delete(e->dest_pos,e->dest->in);
+    else if(e->dest_pos != e->origin_pos)
+        delete(e->dest_pos,e->dest->out);
+
+    delete(e->pos,g->edges);
+
+    void* data = e->data_ptr;
+    free(e);
+    return data;
+}
+
+void* gr_remove_vertex(graph* g, gr_vertex* v){
+
+    if(g == NULL || v == NULL)
+        return NULL;
+
+    while(is_empty(v->out) == FALSE)
+        gr_remove_edge(g,first(v->out)->data_ptr);
+
+    while(v->in != NULL && is_empty(v->in) == FALSE)
+        gr_remove_edge(g,first(v->in)->data_ptr);
+
+    delete(v->pos,g->vertices);
+    destroy_p_list(v->out);
+    destroy_p_list(v->in);
+
+    void* data = v->data_ptr;
+    free(v);
+    return data;
+}
+
+gr_edge* gr_get_edge(graph* g, gr_vertex* origin, gr_vertex* dest){
+
+    if(g == NULL || origin == NULL || dest == NULL)
+        return NULL;
+
+    p_list* from_origin = origin->out;
+    p_list* to_dest = g->directed ? dest->in : dest->out;
+
+    if(from_origin->num_elements <= to_dest->num_elements){
+        for(pl_cursor cur = pl_cursor_begin(from_origin); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur)){
+            gr_edge* e = pl_cursor_get(&cur);
+            if(gr_opposite(origin,e) == dest)
+                return e;
+        }
+    }
+    else{
+        for(pl_cursor cur = pl_cursor_begin(to_dest); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur)){
+            gr_edge* e = pl_cursor_get(&cur);
+            if(gr_opposite(dest,e) == origin)
+                return e;
+        }
+    }
+
+    return NULL;
+}
+
+gr_vertex* gr_opposite(gr_vertex* v, gr_edge* e){
+
+    if(v == NULL || e == NULL)
+        return NULL;
+
+    if(e->origin == v)
+        return e->dest;
+
+    return e->dest == v ? e->origin : NULL;
+}
+
+uint gr_out_degree(gr_vertex* v){
+    return (v != NULL) ? v->out->num_elements : 0;
+}
+
+uint gr_in_degree(gr_vertex* v){
+
+    if(v == NULL)
+        return 0;
+
+    return v->in != NULL ? v->in->num_elements : v->out->num_elements;
+}
+
+////////////////////// END OF GRAPH FUNCTIONS //////////////////////
+
+
+////////////////////// CSR FUNCTIONS //////////////////////
+
+gr_csr* graph_freeze(graph* g){
+
+    if(g == NULL)
+        return NULL;
+
+    gr_csr* csr = malloc(sizeof(gr_csr));
+
+    if(csr == NULL)
+        return NULL;
+
+    uint32_t n = g->vertices->num_elements;
+    uint32_t m = 0;
+
+    for(pl_cursor cur = pl_cursor_begin(g->vertices); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur))
+        m += ((gr_vertex*) pl_cursor_get(&cur))->out->num_elements;
+
+    csr->num_vertices = n;
+    csr->num_entries = m;
+    csr->directed = g->directed;
+    csr->offsets = malloc((n + 1) * sizeof(uint32_t));
+    csr->targets = malloc((m > 0 ? m : 1) * sizeof(uint32_t));
+    csr->edges = malloc((m > 0 ? m : 1) * sizeof(gr_edge*));
+    csr->vertices = malloc((n > 0 ? n : 1) * sizeof(gr_vertex*));
+
+    if(csr->offsets == NULL || csr->targets == NULL || csr->edges == NULL || csr->vertices == NULL)
+        return destroy_csr(csr);
+
+    // number the vertices first, so that every row can name its neighbours.
+    uint32_t id = 0;
+    for(pl_cursor cur = pl_cursor_begin(g->vertices); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur)){
+        gr_vertex* v = pl_cursor_get(&cur);
+        v->id = id;
+        csr->vertices[id++] = v;
+    }
+
+    uint32_t k = 0;
+    for(uint32_t v=0; v<n; ++v){
+
+        csr->offsets[v] = k;
+
+        for(pl_cursor cur = pl_cursor_begin(csr->vertices[v]->out); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur)){
+            gr_edge* e = pl_cursor_get(&cur);
+            csr->targets[k] = gr_opposite(csr->vertices[v],e)->id;
+            csr->edges[k++] = e;
+        }
+    }
+
+    csr->offsets[n] = k;
+    return csr;
+}
+
+gr_csr* destroy_csr(gr_csr* csr){
+
+    if(csr != NULL){
+        free(csr->offsets);
+        free(csr->targets);
+        free(csr->edges);
+        free(csr->vertices);
+        free(csr);
+    }
+
+    return NULL;
+}
+
+uint32_t csr_bfs(gr_csr* csr, uint32_t source, uint32_t* dist, uint32_t* parent){
+
+    if(csr == NULL || dist == NULL || source >= csr->num_vertices)
+        return 0;
+
+    uint32_t n = csr->num_vertices;
+
+    for(uint32_t v=0; v<n; ++v)
+        dist[v] = CSR_NONE;
+    if(parent != NULL){
+        for(uint32_t v=0; v<n; ++v)
+            parent[v] = CSR_NONE;
+    }
+
+    uint32_t* queue = malloc(n * sizeof(uint32_t));
+
+    if(queue == NULL)
+        return 0;
+
+    uint32_t head = 0;
+    uint32_t tail = 0;
+    queue[tail++] = source;
+    dist[source] = 0;
+
+    while(head < tail){
+
+        uint32_t u = queue[head++];
+
+        for(uint32_t k = csr->offsets[u]; k < csr->offsets[u + 1]; ++k){
+            uint32_t v = csr->targets[k];
+            if(dist[v] == CSR_NONE){
+                dist[v] = dist[u] + 1;
+                if(parent != NULL)
+                    parent[v] = u;
+                queue[tail++] = v;
+            }
+        }
+    }
+
+    free(queue);
+    return tail;
+}
+
+/**
+ * @brief The state the threads of a parallel BFS share.
+ */
+typedef struct bfs_shared{
+    gr_csr* csr;
+    uint32_t* dist;
+    uint32_t* parent;
+
+    /// @brief The vertices of the current level and of the next one.
+    uint32_t* frontier;
+    uint32_t* next;
+    uint32_t frontier_len;
+    uint32_t next_len;
+
+    /// @brief The index of the next chunk of the current level to hand out.
+    uint32_t cursor;
+
+    /// @brief The distance of the vertices of the current level.
+    uint32_t level;
+
+    /// @brief The number of vertices reached so far.
+    uint32_t reached;
+
+    /// @brief Held while the threads are created, so that none uses the barrier before it
+    /// is set up for the number of threads that were actually created.
+    pthread_mutex_t start_lock;
+    pthread_barrier_t barrier;
+} bfs_shared;
+
+/**
+ * @brief Appends the vertices a thread discovered to the next level.
+ */
+static void bfs_flush(bfs_shared* s, uint32_t* buffer, uint32_t count){
+
+    uint32_t at = __atomic_fetch_add(&s->next_len,count,__ATOMIC_RELAXED);
+
+    for(uint32_t i=0; i<count; ++i)
+        s->next[at + i] = buffer[i];
+}
+
+/**
+ * @brief The loop of a thread of the parallel BFS: expand chunks of the current level, then
+ * wait for the other threads at the barrier, where one of them makes the next level current.
+ */
+static void* bfs_worker(void* arg){
+
+    bfs_shared* s = arg;
+    uint32_t buffer[CSR_BFS_BUFFER];
+
+    pthread_mutex_lock(&s->start_lock);
+    pthread_mutex_unlock(&s->start_lock);
+
+    while(s->frontier_len > 0){
+
+        uint32_t count = 0;
+        uint32_t next_dist = s->level + 1;
+        uint32_t start;
+
+        while((start = __atomic_fetch_add(&s->cursor,CSR_BFS_CHUNK,__ATOMIC_RELAXED)) < s->frontier_len){
+
+            uint32_t end = start + CSR_BFS_CHUNK < s->frontier_len ? start + CSR_BFS_CHUNK : s->frontier_len;
+
+            for(uint32_t i=start; i<end; ++i){
+
+                uint32_t u = s->frontier[i];
+
+                for(uint32_t k = s->csr->offsets[u]; k < s->csr->offsets[u + 1]; ++k){
+
+                    uint32_t v = s->csr->targets[k];
+                    uint32_t expected = CSR_NONE;
+
+                    // a plain read first keeps the compare-and-swap off visited vertices.
+                    if(__atomic_load_n(&s->dist[v],__ATOMIC_RELAXED) != CSR_NONE)
+                        continue;
+                    if(!__atomic_compare_exchange_n(&s->dist[v],&expected,next_dist,false,__ATOMIC_RELAXED,__ATOMIC_RELAXED))
+                        continue;
+
+                    if(s->parent != NULL)
+                        s->parent[v] = u;
+
+                    buffer[count++] = v;
+                    if(count == CSR_BFS_BUFFER){
+                        bfs_flush(s,buffer,count);
+                        count = 0;
+                    }
+                }
+            }
+        }
+
+        bfs_flush(s,buffer,count);
+
+        if(pthread_barrier_wait(&s->barrier) == PTHREAD_BARRIER_SERIAL_THREAD){
+            uint32_t* tmp = s->frontier;
+            s->frontier = s->next;
+            s->next = tmp;
+            s->frontier_len = s->next_len;
+            s->reached += s->next_len;
+            s->next_len = 0;
+            s->cursor = 0;
+            ++(s->level);
+        }
+
+        pthread_barrier_wait(&s->barrier);
+    }
+
+    return NULL;
+}
+
+uint32_t csr_parallel_bfs(gr_csr* csr, uint32_t source, uint32_t* dist, uint32_t* parent, uint32_t num_threads){
+
+    if(csr == NULL || dist == NULL || source >= csr->num_vertices)
+        return 0;
+
+    if(num_threads == 0){
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = online > 0 ? (uint32_t) online : 1;
+    }
+
+    if(num_threads == 1)
+        return csr_bfs(csr,source,dist,parent);
+
+    uint32_t n = csr->num_vertices;
+    bfs_shared s;
+    pthread_t* threads = malloc((num_threads - 1) * sizeof(pthread_t));
+
+    s.csr = csr;
+    s.dist = dist;
+    s.parent = parent;
+    s.frontier = malloc(n * sizeof(uint32_t));
+    s.next = malloc(n * sizeof(uint32_t));
+
+    if(threads == NULL || s.frontier == NULL || s.next == NULL){
+        free(threads);
+        free(s.frontier);
+        free(s.next);
+        return csr_bfs(csr,source,dist,parent);
+    }
+
+    for(uint32_t v=0; v<n; ++v)
+        dist[v] = CSR_NONE;
+    if(parent != NULL){
+        for(uint32_t v=0; v<n; ++v)
+            parent[v] = CSR_NONE;
+    }
+
+    dist[source] = 0;
+    s.frontier[0] = source;
+    s.frontier_len = 1;
+    s.next_len = 0;
+    s.cursor = 0;
+    s.level = 0;
+    s.reached = 1;
+
+    pthread_mutex_init(&s.start_lock,NULL);
+    pthread_mutex_lock(&s.start_lock);
+
+    uint32_t created = 0;
+    while(created < num_threads - 1 && pthread_create(&threads[created],NULL,bfs_worker,&s) == 0)
+        ++created;
+
+    pthread_barrier_init(&s.barrier,NULL,created + 1);
+    pthread_mutex_unlock(&s.start_lock);
+
+    bfs_worker(&s);
+
+    for(uint32_t i=0; i<created; ++i)
+        pthread_join(threads[i],NULL);
+
+    pthread_barrier_destroy(&s.barrier);
+    pthread_mutex_destroy(&s.start_lock);
+    free(threads);
+    free(s.frontier);
+    free(s.next);
+    return s.reached;
+}
+
+uint32_t csr_dfs(gr_csr* csr, uint32_t source, uint32_t* order){
+
+    if(csr == NULL || order == NULL || source >= csr->num_vertices)
+        return 0;
+
+    uint32_t n = csr->num_vertices;
+    bool* seen = calloc(n,sizeof(bool));
+
+    // every stacked vertex keeps the index of the next entry of its row to look at.
+    uint32_t* stack = malloc(n * sizeof(uint32_t));
+    uint32_t* next_entry = malloc(n * sizeof(uint32_t));
+
+    if(seen == NULL || stack == NULL || next_entry == NULL){
+        free(seen);
+        free(stack);
+        free(next_entry);
+        return 0;
+    }
+
+    uint32_t count = 0;
+    uint32_t top = 0;
+
+    seen[source] = true;
+    order[count++] = source;
+    stack[top] = source;
+    next_entry[top++] = csr->offsets[source];
+
+    while(top > 0){
+
+        uint32_t u = stack[top - 1];
+        uint32_t k = next_entry[top - 1];
+
+        // skip the neighbours that were already discovered.
+        while(k < csr->offsets[u + 1] && seen[csr->targets[k]])
+            ++k;
+
+        if(k == csr->offsets[u + 1]){
+            --top;
+            continue;
+        }
+
+        next_entry[top - 1] = k + 1;
+
+        uint32_t v = csr->targets[k];
+        seen[v] = true;
+        order[count++] = v;
+        stack[top] = v;
+        next_entry[top++] = csr->offsets[v];
+    }
+
+    free(seen);
+    free(stack);
+    free(next_entry);
+    return count;
+}
+
+bool csr_topological_sort(gr_csr* csr, uint32_t* order){
+
+    if(csr == NULL || order == NULL || !csr->directed)
+        return false;
+
+    uint32_t n = csr->num_vertices;
+    uint32_t* in_degree = calloc(n > 0 ? n : 1,sizeof(uint32_t));
+
+    if(in_degree == NULL)
+        return false;
+
+    for(uint32_t k=0; k<csr->num_entries; ++k)
+        ++in_degree[csr->targets[k]];
+
+    // the output array doubles as the queue of vertices whose predecessors are all placed.
+    uint32_t tail = 0;
+    for(uint32_t v=0; v<n; ++v){
+        if(in_degree[v] == 0)
+            order[tail++] = v;
+    }
+
+    for(uint32_t head=0; head<tail; ++head){
+
+        uint32_t u = order[head];
+
+        for(uint32_t k = csr->offsets[u]; k < csr->offsets[u + 1]; ++k){
+            if(--in_degree[csr->targets[k]] == 0)
+                order[tail++] = csr->targets[k];
+        }
+    }
+
+    free(in_degree);
+    return tail == n;
+}
+
+/**
+ * @brief Returns the root of a vertex's tree in a union-find forest, halving the path to it.
+ */
+static inline uint32_t find_root(uint32_t* forest, uint32_t v){
+
+    while(forest[v] != v){
+        forest[v] = forest[forest[v]];
+        v = forest[v];
+    }
+
+    return v;
+}
+
+uint32_t csr_components(gr_csr* csr, uint32_t* component){
+
+    if(csr == NULL || component == NULL)
+        return 0;
+
+    uint32_t n = csr->num_vertices;
+    uint32_t* forest = malloc((n > 0 ? n : 1) * sizeof(uint32_t));
+
+    if(forest == NULL)
+        return 0;
+
+    for(uint32_t v=0; v<n; ++v)
+        forest[v] = v;
+
+    // the smaller root becomes the parent, so every root is the smallest id of its tree.
+    for(uint32_t u=0; u<n; ++u){
+        for(uint32_t k = csr->offsets[u]; k < csr->offsets[u + 1]; ++k){
+            uint32_t a = find_root(forest,u);
+            uint32_t b = find_root(forest,csr->targets[k]);
+            if(a < b)
+                forest[b] = a;
+            else if(b < a)
+                forest[a] = b;
+        }
+    }
+
+    // a root is visited before the other vertices of its tree, and numbers the component.
+    uint32_t count = 0;
+    for(uint32_t v=0; v<n; ++v){
+        uint32_t root = find_root(forest,v);
+        component[v] = root == v ? count++ : component[root];
+    }
+
+    free(forest);
+    return count;
+}
+
+////////////////////// END OF CSR FUNCTIONS //////////////////////
@@ -0,0 +1,277 @@
+/**
+ * @brief This gt_diff.c file contains the implementations of the functions that compute and
+ * apply the change scripts described by the "gt_script" and "gt_edit" structs.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/gt_diff.h"
+#include <string.h>
+
+//////////////////////////////// SCRIPT HELPERS ////////////////////////////////
+
+/**
+ * @brief A pending step of a diff: a pair of positions to compare, or a new position to
+ * insert when old_pos is null, with the depth and sibling index of the position.
+ */
+typedef struct diff_frame{
+    gt_pos* old_pos;
+    gt_pos* new_pos;
+    unsigned int depth;
+    unsigned int index;
+} diff_frame;
+
+/**
+ * @brief Appends an edit with a copy of its path to a change script.
+ */
+static bool script_push(gt_script* script, gt_edit_kind kind, const unsigned int* path, unsigned int depth, void* data){
+
+    if(script->num_edits == script->edits_cap){
+        unsigned int cap = script->edits_cap > 0 ? script->edits_cap * 2 : 16;
+        gt_edit* edits = realloc(script->edits,cap * sizeof(gt_edit));
+        if(edits == NULL)
+            return false;
+        script->edits = edits;
+        script->edits_cap = cap;
+    }
+
+    if(script->paths_len + depth > script->paths_cap){
+        unsigned int cap = script->paths_cap > 0 ? script->paths_cap : 64;
+        while(cap < script->paths_len + depth)
+            cap *= 2;
+        unsigned int* paths = realloc(script->paths,cap * sizeof(unsigned int));
+        if(paths == NULL)
+            return false;
+        script->paths = paths;
+        script->paths_cap = cap;
+    }
+
+    gt_edit* edit = &script->edits[script->num_edits++];
+    edit->kind = kind;
+    edit->depth = depth;
+    edit->path_offset = script->paths_len;
+    edit->data_ptr = data;
+
+    if(depth > 0)
+        memcpy(script->paths + script->paths_len,path,depth * sizeof(unsigned int));
+    script->paths_len += depth;
+
+    return true;
+}
+
+/**
+ * @brief Emits the insertions that rebuild the subtree rooted at pos, in pre-order so that
+ * every parent exists, and every earlier sibling is in place, before a child is inserted.
+ * The frames from "base" upwards are used as the stack.
+ */
+static bool emit_subtree(gt_script* script, gt_pos* pos, unsigned int* path, unsigned int depth, diff_frame* frames, unsigned int base){
+
+    unsigned int top = base;
+    frames[top++] = (diff_frame){NULL,pos,depth,depth > 0 ? path[depth - 1] : 0};
+
+    while(top > base){
+
+        diff_frame frame = frames[--top];
+
+        if(frame.depth > 0)
+            path[frame.depth - 1] = frame.index;
+
+        if(!script_push(script,GT_EDIT_INSERT,path,frame.depth,frame.new_pos->data_ptr))
+            return false;
+
+        // push the children last to first so that they are inserted first to last.
+        for(unsigned int i = frame.new_pos->num_children; i > 0; --i)
+            frames[top++] = (diff_frame){NULL,frame.new_pos->children[i - 1],frame.depth + 1,i - 1};
+    }
+
+    return true;
+}
+
+/**
+ * @brief Returns the position at the end of a path, or null if the path does not exist.
+ */
+static gt_pos* resolve_edit_path(g_tree* tree, const unsigned int* path, unsigned int depth){
+
+    gt_pos* pos = get_root(tree);
+
+    for(unsigned int i=0; i<depth && pos != NULL; ++i)
+        pos = path[i] < pos->num_children ? pos->children[path[i]] : NULL;
+
+    return pos;
+}
+
+//////////////////////////////// END OF SCRIPT HELPERS ////////////////////////////////
+
+gt_script* gt_diff(g_tree* old_tree, g_tree* new_tree, gt_key_equals equals){
+
+    if(old_tree == NULL || new_tree == NULL || new_tree->data_hash == NULL || old_tree->data_hash != new_tree->data_hash)
+        return NULL;
+
+    gt_script* script = malloc(sizeof(gt_script));
+
+    if(script == NULL)
+        return NULL;
+
+    script->edits = NULL;
+    script->num_edits = 0;
+    script->edits_cap = 0;
+    script->paths = NULL;
+    script->paths_len = 0;
+    script->paths_cap = 0;
+
+    gt_pos* old_root = get_root(old_tree);
+    gt_pos* new_root = get_root(new_tree);
+
+    if(new_root == NULL){
+        if(old_root != NULL && !script_push(script,GT_EDIT_DELETE,NULL,0,NULL))
+            return destroy_gt_script(script);
+        return script;
+    }
+
+    // every frame stands for a distinct position of the new tree, and no path is longer
+    // than the new tree is high.
+    unsigned int n = get_size(new_tree);
+    diff_frame* frames = malloc(n * sizeof(diff_frame));
+    unsigned int* path = malloc((n + 1) * sizeof(unsigned int));
+    unsigned int top = 0;
+    bool ok = frames != NULL && path != NULL;
+
+    if(ok && old_root == NULL)
+        ok = emit_subtree(script,new_root,path,0,frames,0);
+    else if(ok){
+        // hash both trees up front; the hashes of all descendants are then cached.
+        gt_subtree_hash(old_root,old_tree);
+        gt_subtree_hash(new_root,new_tree);
+        frames[top++] = (diff_frame){old_root,new_root,0,0};
+    }
+
+    while(ok && top > 0){
+
+        diff_frame frame = frames[--top];
+        gt_pos* old_pos = frame.old_pos;
+        gt_pos* new_pos = frame.new_pos;
+        unsigned int depth = frame.depth;
+
+        if(depth > 0)
+            path[depth - 1] = frame.index;
+
+        // equal hashes mean equal subtrees, which need no edits.
+        if(old_pos->subtree_hash == new_pos->subtree_hash)
+            continue;
+
+        bool same_data = equals != NULL ? equals(old_pos->data_ptr,new_pos->data_ptr) : old_pos->data_ptr == new_pos->data_ptr;
+
+        if(!same_data && !script_push(script,GT_EDIT_REPLACE,path,depth,new_pos->data_ptr)){
+            ok = false;
+            break;
+        }
+
+        // skip the children that are unchanged at both ends.
+        gt_pos** old_children = old_pos->children;
+        gt_pos** new_children = new_pos->children;
+        unsigned int num_old = old_pos->num_children;
+        unsigned int num_new = new_pos->num_children;
+        unsigned int prefix = 0;
+        unsigned int suffix = 0;
+
+        while(prefix < num_old && prefix < num_new && old_children[prefix]->subtree_hash == new_children[prefix]->subtree_hash)
+            ++prefix;
+
+        while(suffix < num_old - prefix && suffix < num_new - prefix && old_children[num_old - 1 - suffix]->subtree_hash == new_children[num_new - 1 - suffix]->subtree_hash)
+            ++suffix;
+
+        // the changed children in between are paired by index; the old ones left over are
+        // deleted and the new ones left over are inserted, after the paired ones.
+        unsigned int mid_old = num_old - prefix - suffix;
+        unsigned int mid_new = num_new - prefix - suffix;
+        unsigned int paired = mid_old < mid_new ? mid_old : mid_new;
+
+        path[depth] = prefix + paired;
+        for(unsigned int k = paired; k < mid_old && ok; ++k)
+            ok = script_push(script,GT_EDIT_DELETE,path,depth + 1,NULL);
+
+        for(unsigned int k = paired; k < mid_new && ok; ++k){
+            path[depth] = prefix + k;
+            ok = emit_subtree(script,new_children[prefix + k],path,depth + 1,frames,top);
+        }
+
+        for(unsigned int k = paired; k > 0 && ok; --k)
+            frames[top++] = (diff_frame){old_children[prefix + k - 1],new_children[prefix + k - 1],depth + 1,prefix + k - 1};
+    }
+
+    free(frames);
+    free(path);
+
+    if(!ok)
+        return destroy_gt_script(script);
+
+    return script;
+}
+
+bool gt_apply_diff(g_tree* tree, gt_script* script){
+
+    if(tree == NULL || script == NULL)
+        return false;
+
+    for(unsigned int i=0; i<script->num_edits; ++i){
+
+        gt_edit* edit = &script->edits[i];
+        const unsigned int* path = script->paths + edit->path_offset;
+
+        switch(edit->kind){
+
+            case GT_EDIT_INSERT:
+                if(edit->depth == 0){
+                    if(add_gt_root(tree,edit->data_ptr) == NULL)
+                        return false;
+                }
+                else{
+                    gt_pos* parent = resolve_edit_path(tree,path,edit->depth - 1);
+                    if(gt_insert_child_at(edit->data_ptr,parent,path[edit->depth - 1],tree) == NULL)
+                        return false;
+                }
+                break;
+
+            case GT_EDIT_DELETE:{
+                gt_pos* pos = resolve_edit_path(tree,path,edit->depth);
+                if(pos == NULL)
+                    return false;
+                remove_gt_pos(pos,tree);
+                break;
+            }
+
+            case GT_EDIT_REPLACE:{
+                gt_pos* pos = resolve_edit_path(tree,path,edit->depth);
+                if(pos == NULL)
+                    return false;
+                gt_replace(pos,edit->data_ptr,tree);
+                break;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+const unsigned int* gt_edit_path(gt_script* script, unsigned int i){
+
+    if(script == NULL || i >= script->num_edits || script->edits[i].depth == 0)
+        return NULL;
+
+    return script->paths + script->edits[i].path_offset;
+}
+
+gt_script* destroy_gt_script(gt_script* script){
+
+    if(script != NULL){
+        free(script->edits);
+        free(script->paths);
+        free(script);
+    }
+
+    return NULL;
+}
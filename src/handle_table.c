@@ -0,0 +1,113 @@
+/**
+ * @brief This handle_table.c file contains the implementations of the functions that
+ * access and manipulate the "h_table" struct.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/handle_table.h"
+
+/// @brief The number of slots a table starts with.
+#define H_DEFAULT_CAPACITY 16
+
+h_table* init_h_table(){
+
+    h_table* table = malloc(sizeof(h_table));
+
+    if(table != NULL){
+        table->slots = malloc(H_DEFAULT_CAPACITY * sizeof(h_slot));
+
+        if(table->slots == NULL){
+            free(table);
+            return NULL;
+        }
+
+        table->capacity = H_DEFAULT_CAPACITY;
+        table->num_used = 0;
+        table->num_live = 0;
+        table->free_head = H_NO_SLOT;
+    }
+
+    return table;
+}
+
+h_table* destroy_h_table(h_table* table){
+
+    if(table != NULL){
+        free(table->slots);
+        table->slots = NULL;
+        free(table);
+    }
+
+    return NULL;
+}
+
+h_handle h_alloc(h_table* table, void* ptr){
+
+    if(table == NULL || ptr == NULL)
+        return H_NULL;
+
+    uint32_t index;
+
+    if(table->free_head != H_NO_SLOT){
+        // reuse a released slot, whose generation was advanced on release.
+        index = table->free_head;
+        table->free_head = table->slots[index].next_free;
+    }
+    else{
+
+        if(table->num_used == H_MAX_SLOTS)
+            return H_NULL;
+
+        if(table->num_used == table->capacity){
+
+            uint32_t new_cap = table->capacity * 2 > H_MAX_SLOTS ? H_MAX_SLOTS : table->capacity * 2;
+            h_slot* slots = realloc(table->slots, new_cap * sizeof(h_slot));
+
+            if(slots == NULL)
+                return H_NULL;
+
+            table->slots = slots;
+            table->capacity = new_cap;
+        }
+
+        index = table->num_used++;
+        table->slots[index].gen = 1;
+    }
+
+    table->slots[index].ptr = ptr;
+    table->slots[index].next_free = H_NO_SLOT;
+    ++table->num_live;
+
+    return (table->slots[index].gen << H_INDEX_BITS) | index;
+}
+
+bool h_release(h_table* table, h_handle handle){
+
+    if(h_resolve(table, handle) == NULL)
+        return false;
+
+    h_slot* slot = &table->slots[h_index(handle)];
+
+    // advance the generation, skipping 0 so that H_NULL never becomes valid.
+    slot->gen = (slot->gen + 1) & H_GEN_MASK;
+    if(slot->gen == 0)
+        slot->gen = 1;
+
+    slot->ptr = NULL;
+    slot->next_free = table->free_head;
+    table->free_head = h_index(handle);
+    --table->num_live;
+
+    return true;
+}
+
+bool h_relocate(h_table* table, h_handle handle, void* ptr){
+
+    if(ptr == NULL || h_resolve(table, handle) == NULL)
+        return false;
+
+    table->slots[h_index(handle)].ptr = ptr;
+    return true;
+}
@@ -0,0 +1,469 @@
+/**
+ * @brief This hc_tree.c file contains the implementations of the functions that access and
+ * manipulate the "hc_store", "hc_node" and "hc_builder" structs.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/hc_tree.h"
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+
+//////////////////////////////// STORE HELPERS ////////////////////////////////
+
+/**
+ * @brief Doubles the number of slots and re-files every node.
+ */
+static bool store_grow(hc_store* store){
+
+    unsigned int cap = store->cap * 2;
+    hc_node** slots = calloc(cap,sizeof(hc_node*));
+
+    if(slots == NULL)
+        return false;
+
+    for(unsigned int i=0; i<store->cap; ++i){
+
+        hc_node* node = store->slots[i];
+
+        if(node != NULL){
+            unsigned int j = node->hash & (cap - 1);
+            while(slots[j] != NULL)
+                j = (j + 1) & (cap - 1);
+            slots[j] = node;
+        }
+    }
+
+    free(store->slots);
+    store->slots = slots;
+    store->cap = cap;
+    return true;
+}
+
+/**
+ * @brief Takes a node out of the table, moving back the nodes after it in its probe run that
+ * would otherwise no longer be found.
+ */
+static void store_remove(hc_store* store, hc_node* node){
+
+    unsigned int mask = store->cap - 1;
+    unsigned int i = node->hash & mask;
+
+    while(store->slots[i] != node)
+        i = (i + 1) & mask;
+
+    store->slots[i] = NULL;
+
+    for(unsigned int j = (i + 1) & mask; store->slots[j] != NULL; j = (j + 1) & mask){
+
+        unsigned int home = store->slots[j]->hash & mask;
+
+        // the node stays if its home slot lies cyclically in (i, j].
+        bool stays = i < j ? (home > i && home <= j) : (home > i || home <= j);
+
+        if(!stays){
+            store->slots[i] = store->slots[j];
+            store->slots[j] = NULL;
+            i = j;
+        }
+    }
+
+    --store->count;
+    store->node_bytes -= sizeof(hc_node) + node->num_children * sizeof(hc_node*);
+}
+
+/**
+ * @brief Makes room for one more element in a growable array.
+ */
+static bool reserve(void** array, unsigned int* cap, unsigned int count, size_t elem_size){
+
+    if(count < *cap)
+        return true;
+
+    unsigned int new_cap = *cap > 0 ? *cap * 2 : 16;
+    void* grown = realloc(*array,new_cap * elem_size);
+
+    if(grown == NULL)
+        return false;
+
+    *array = grown;
+    *cap = new_cap;
+    return true;
+}
+
+//////////////////////////////// END OF STORE HELPERS ////////////////////////////////
+
+
+//////////////////////////////// STORE FUNCTIONS ////////////////////////////////
+
+hc_store* init_hc_store(gt_key_hash hash, gt_key_equals equals){
+
+    if(hash == NULL || equals == NULL)
+        return NULL;
+
+    hc_store* store = malloc(sizeof(hc_store));
+
+    if(store == NULL)
+        return NULL;
+
+    store->slots = calloc(HC_INITIAL_SLOTS,sizeof(hc_node*));
+
+    if(store->slots == NULL){
+        free(store);
+        return NULL;
+    }
+
+    store->cap = HC_INITIAL_SLOTS;
+    store->count = 0;
+    store->node_bytes = 0;
+    store->data_hash = hash;
+    store->data_equals = equals;
+    return store;
+}
+
+hc_store* destroy_hc_store(hc_store* store){
+
+    if(store != NULL){
+
+        for(unsigned int i=0; i<store->cap; ++i)
+            free(store->slots[i]);
+
+        free(store->slots);
+        free(store);
+    }
+
+    return NULL;
+}
+
+unsigned int hc_store_size(hc_store* store){
+    return (store != NULL) ? store->count : 0;
+}
+
+size_t hc_memory_usage(hc_store* store){
+
+    if(store == NULL)
+        return 0;
+
+    return sizeof(hc_store) + store->cap * sizeof(hc_node*) + store->node_bytes;
+}
+
+//////////////////////////////// END OF STORE FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// NODE FUNCTIONS ////////////////////////////////
+
+hc_node* hc_make(hc_store* store, void* data, hc_node** children, unsigned int n){
+
+    bool valid = store != NULL && (n == 0 || children != NULL);
+
+    for(unsigned int i=0; valid && i<n; ++i)
+        valid = children[i] != NULL;
+
+    if(!valid){
+        for(unsigned int i=0; store != NULL && children != NULL && i<n; ++i)
+            hc_release(store,children[i]);
+        return NULL;
+    }
+
+    // hashed the way gt_subtree_hash() hashes a position, so the two agree.
+    size_t hash = gt_combine_hash(gt_mix_hash(store->data_hash(data)),n);
+
+    for(unsigned int i=0; i<n; ++i)
+        hash = gt_combine_hash(hash,children[i]->hash);
+
+    hash = hash != 0 ? hash : 1;
+
+    // the children are already unique, so equal subtrees have the very same children.
+    unsigned int mask = store->cap - 1;
+    size_t children_bytes = n * sizeof(hc_node*);
+
+    for(unsigned int i = hash & mask; store->slots[i] != NULL; i = (i + 1) & mask){
+
+        hc_node* node = store->slots[i];
+
+        if(node->hash == hash && node->num_children == n && (n == 0 || memcmp(node->children,children,children_bytes) == 0) && store->data_equals(node->data_ptr,data)){
+
+            // the node already holds references to the children, so the caller's go away.
+            for(unsigned int c=0; c<n; ++c)
+                --children[c]->refcount;
+
+            ++node->refcount;
+            return node;
+        }
+    }
+
+    hc_node* node = NULL;
+
+    if((store->count + 1) * 4 <= store->cap * 3 || store_grow(store))
+        node = malloc(sizeof(hc_node) + children_bytes);
+
+    if(node == NULL){
+        for(unsigned int i=0; i<n; ++i)
+            hc_release(store,children[i]);
+        return NULL;
+    }
+
+    node->data_ptr = data;
+    node->hash = hash;
+    node->size = 1;
+    node->refcount = 1;
+    node->num_children = n;
+
+    for(unsigned int i=0; i<n; ++i){
+        node->children[i] = children[i];
+        node->size += children[i]->size;
+    }
+
+    mask = store->cap - 1;
+    unsigned int slot = hash & mask;
+
+    while(store->slots[slot] != NULL)
+        slot = (slot + 1) & mask;
+
+    store->slots[slot] = node;
+    ++store->count;
+    store->node_bytes += sizeof(hc_node) + children_bytes;
+    return node;
+}
+
+hc_node* hc_retain(hc_node* node){
+
+    if(node != NULL)
+        ++node->refcount;
+
+    return node;
+}
+
+hc_node* hc_release(hc_store* store, hc_node* node){
+
+    if(store == NULL || node == NULL)
+        return NULL;
+
+    // an explicit stack, so that deep trees are safe.
+    hc_node** stack = NULL;
+    unsigned int top = 0;
+    unsigned int cap = 0;
+    hc_node* curr = node;
+
+    while(curr != NULL){
+
+        if(--curr->refcount == 0){
+
+            if(top + curr->num_children > cap){
+                unsigned int new_cap = cap > 0 ? cap * 2 : 64;
+                while(new_cap < top + curr->num_children)
+                    new_cap *= 2;
+                hc_node** grown = realloc(stack,new_cap * sizeof(hc_node*));
+                if(grown == NULL){
+                    // keep the node rather than lose its children's references; the
+                    // store still frees it when it is destroyed.
+                    ++curr->refcount;
+                    break;
+                }
+                stack = grown;
+                cap = new_cap;
+            }
+
+            if(curr->num_children > 0)
+                memcpy(stack + top,curr->children,curr->num_children * sizeof(hc_node*));
+            top += curr->num_children;
+            store_remove(store,curr);
+            free(curr);
+        }
+
+        curr = top > 0 ? stack[--top] : NULL;
+    }
+
+    free(stack);
+    return NULL;
+}
+
+void* hc_element(hc_node* node){
+    return (node != NULL) ? node->data_ptr : NULL;
+}
+
+hc_node* hc_child(hc_node* node, unsigned int i){
+    return (node != NULL && i < node->num_children) ? node->children[i] : NULL;
+}
+
+unsigned int hc_num_children(hc_node* node){
+    return (node != NULL) ? node->num_children : 0;
+}
+
+unsigned long hc_size(hc_node* node){
+    return (node != NULL) ? node->size : 0;
+}
+
+//////////////////////////////// END OF NODE FUNCTIONS ////////////////////////////////
+
+
+//////////////////////////////// BUILDER FUNCTIONS ////////////////////////////////
+
+hc_builder* init_hc_builder(hc_store* store){
+
+    if(store == NULL)
+        return NULL;
+
+    hc_builder* builder = malloc(sizeof(hc_builder));
+
+    if(builder != NULL){
+        builder->store = store;
+        builder->open = NULL;
+        builder->num_open = 0;
+        builder->open_cap = 0;
+        builder->done = NULL;
+        builder->num_done = 0;
+        builder->done_cap = 0;
+        builder->failed = false;
+    }
+
+    return builder;
+}
+
+bool hc_begin(hc_builder* builder, void* data){
+
+    if(builder == NULL || builder->failed)
+        return false;
+
+    if(!reserve((void**) &builder->open,&builder->open_cap,builder->num_open,sizeof(hc_frame))){
+        builder->failed = true;
+        return false;
+    }
+
+    builder->open[builder->num_open].data_ptr = data;
+    builder->open[builder->num_open].first_child = builder->num_done;
+    ++builder->num_open;
+    return true;
+}
+
+bool hc_end(hc_builder* builder){
+
+    if(builder == NULL || builder->failed)
+        return false;
+
+    if(builder->num_open == 0 || !reserve((void**) &builder->done,&builder->done_cap,builder->num_done,sizeof(hc_node*))){
+        builder->failed = true;
+        return false;
+    }
+
+    // the finished children of the position are the top of the stack; they are replaced
+    // by the position's own subtree.
+    hc_frame frame = builder->open[--builder->num_open];
+    hc_node* node = hc_make(builder->store,frame.data_ptr,builder->done + frame.first_child,builder->num_done - frame.first_child);
+    builder->num_done = frame.first_child;
+
+    if(node == NULL){
+        builder->failed = true;
+        return false;
+    }
+
+    builder->done[builder->num_done++] = node;
+    return true;
+}
+
+hc_node* hc_finish(hc_builder* builder){
+
+    if(builder == NULL)
+        return NULL;
+
+    hc_node* root = NULL;
+
+    if(!builder->failed && builder->num_open == 0 && builder->num_done == 1)
+        root = builder->done[0];
+    else{
+        for(unsigned int i=0; i<builder->num_done; ++i)
+            hc_release(builder->store,builder->done[i]);
+    }
+
+    free(builder->open);
+    free(builder->done);
+    free(builder);
+    return root;
+}
+
+hc_node* hc_from_gt(hc_store* store, g_tree* tree){
+
+    if(store == NULL || tree == NULL || !has_root(tree))
+        return NULL;
+
+    // the positions on the path from the root, each with the index of its next child.
+    struct{ gt_pos* pos; unsigned int next; }* path = malloc(get_size(tree) * sizeof(*path));
+    hc_builder* builder = init_hc_builder(store);
+
+    if(path == NULL || builder == NULL){
+        free(path);
+        hc_finish(builder);
+        return NULL;
+    }
+
+    unsigned int depth = 0;
+    path[depth].pos = get_root(tree);
+    path[depth++].next = 0;
+    bool ok = hc_begin(builder,get_root(tree)->data_ptr);
+
+    while(ok && depth > 0){
+
+        gt_pos* pos = path[depth - 1].pos;
+
+        if(path[depth - 1].next < pos->num_children){
+            gt_pos* child = pos->children[path[depth - 1].next++];
+            path[depth].pos = child;
+            path[depth++].next = 0;
+            ok = hc_begin(builder,child->data_ptr);
+        }
+        else{
+            ok = hc_end(builder);
+            --depth;
+        }
+    }
+
+    free(path);
+    return hc_finish(builder);
+}
+
+g_tree* hc_to_gt(hc_node* node){
+
+    if(node == NULL || node->size > UINT_MAX)
+        return NULL;
+
+    unsigned int n = (unsigned int) node->size;
+    void** data = malloc(n * sizeof(void*));
+    long* parents = malloc(n * sizeof(long));
+    struct{ hc_node* node; long parent; }* stack = malloc(n * sizeof(*stack));
+    g_tree* tree = NULL;
+
+    if(data != NULL && parents != NULL && stack != NULL){
+
+        // number the positions in pre-order, so that children are ordered by their index.
+        unsigned int top = 0;
+        unsigned int count = 0;
+        stack[top].node = node;
+        stack[top++].parent = -1;
+
+        while(top > 0){
+
+            --top;
+            hc_node* curr = stack[top].node;
+            data[count] = curr->data_ptr;
+            parents[count] = stack[top].parent;
+
+            for(unsigned int i = curr->num_children; i > 0; --i){
+                stack[top].node = curr->children[i - 1];
+                stack[top++].parent = count;
+            }
+
+            ++count;
+        }
+
+        tree = gt_build_from_parents(data,parents,n);
+    }
+
+    free(data);
+    free(parents);
+    free(stack);
+    return tree;
+}
+
+//////////////////////////////// END OF BUILDER FUNCTIONS ////////////////////////////////
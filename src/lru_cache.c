@@ -0,0 +1,404 @@
+/**
+ * @brief This lru_cache.c file contains the implementations of the functions that access
+ * and manipulate the "lru_cache" and "lru_sharded" structs.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/lru_cache.h"
+#include "../include/fnv_hash.h"
+#include <string.h>
+#include <stdint.h>
+
+/// @brief Marks an index slot whose entry was removed, so that probing continues past it.
+static pl_pos removed_marker;
+#define REMOVED (&removed_marker)
+
+////////////////////// INDEX HELPERS //////////////////////
+
+/**
+ * @brief Spreads the bits of a hash code so that weak hash functions, such as the identity
+ * on integers, still use the whole index.
+ */
+static inline size_t mix(size_t h){
+    uint64_t x = (uint64_t) h;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return (size_t) x;
+}
+
+/**
+ * @brief Returns the entry stored in a position of the recency list.
+ */
+static inline lru_entry* entry_of(pl_pos* pos){
+    return (lru_entry*) pos->data_ptr;
+}
+
+/**
+ * @brief Returns the index slot holding the position of the key, or -1 if the key is absent.
+ */
+static long find_slot(void* key, size_t hash, lru_cache* cache){
+
+    size_t mask = cache->index_cap - 1;
+
+    for(size_t i = hash & mask; cache->index[i] != NULL; i = (i + 1) & mask){
+        pl_pos* pos = cache->index[i];
+        if(pos != REMOVED && entry_of(pos)->hash == hash && cache->equals(entry_of(pos)->key, key) == TRUE)
+            return (long) i;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Stores a position in the first free or removed slot of its probe sequence.
+ */
+static void insert_slot(pl_pos* pos, lru_cache* cache){
+
+    size_t mask = cache->index_cap - 1;
+    size_t i = entry_of(pos)->hash & mask;
+
+    while(cache->index[i] != NULL && cache->index[i] != REMOVED)
+        i = (i + 1) & mask;
+
+    if(cache->index[i] == REMOVED)
+        --cache->num_removed;
+
+    cache->index[i] = pos;
+}
+
+/**
+ * @brief Marks a slot as removed and rebuilds the index once removed markers make up a
+ * quarter of it, so that probe sequences stay short. The position the slot held is still in
+ * the recency list, about to be deleted or filed again under a new key, so the rebuild skips
+ * it.
+ */
+static void remove_slot(long slot, lru_cache* cache){
+
+    pl_pos* removed = cache->index[slot];
+
+    cache->index[slot] = REMOVED;
+
+    if(++cache->num_removed > cache->index_cap / 4){
+
+        memset(cache->index, 0, cache->index_cap * sizeof(pl_pos*));
+        cache->num_removed = 0;
+
+        for(pl_cursor cur = pl_cursor_begin(cache->order); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur))
+            if(pl_cursor_pos(&cur) != removed)
+                insert_slot(pl_cursor_pos(&cur), cache);
+    }
+}
+
+////////////////////// END OF INDEX HELPERS //////////////////////
+
+
+////////////////////// LRU CACHE FUNCTIONS //////////////////////
+
+lru_cache* init_lru(uint capacity, lru_hash hash, lru_equals equals, lru_evict evict, void* ctx){
+
+    if(capacity == 0 || hash == NULL || equals == NULL)
+        return NULL;
+
+    lru_cache* cache = malloc(sizeof(lru_cache));
+
+    if(cache == NULL)
+        return NULL;
+
+    // keep the index at most half full.
+    uint index_cap = 8;
+    while(index_cap < capacity * 2)
+        index_cap *= 2;
+
+    cache->order = init_p_list();
+    cache->index = calloc(index_cap, sizeof(pl_pos*));
+
+    if(cache->order == NULL || cache->index == NULL){
+        destroy_p_list(cache->order);
+        free(cache->index);
+        free(cache);
+        return NULL;
+    }
+
+    cache->index_cap = index_cap;
+    cache->num_removed = 0;
+    cache->capacity = capacity;
+    cache->hash = hash;
+    cache->equals = equals;
+    cache->evict = evict;
+    cache->evict_ctx = ctx;
+
+    return cache;
+}
+
+lru_cache* destroy_lru(lru_cache* cache){
+
+    if(cache != NULL){
+
+        while(is_empty(cache->order) == FALSE){
+            lru_entry* entry = delete(first(cache->order), cache->order);
+            if(cache->evict != NULL)
+                cache->evict(entry->key, entry->value, cache->evict_ctx);
+            free(entry);
+        }
+
+        destroy_p_list(cache->order);
+        free(cache->index);
+        free(cache);
+    }
+
+    return NULL;
+}
+
+void* lru_get(void* key, lru_cache* cache){
+
+    if(key == NULL || cache == NULL)
+        return NULL;
+
+    long slot = find_slot(key, mix(cache->hash(key)), cache);
+
+    if(slot < 0)
+        return NULL;
+
+    return entry_of(pl_move_first(cache->index[slot], cache->order))->value;
+}
+
+void* lru_peek(void* key, lru_cache* cache){
+
+    if(key == NULL || cache == NULL)
+        return NULL;
+
+    long slot = find_slot(key, mix(cache->hash(key)), cache);
+
+    return slot >= 0 ? entry_of(cache->index[slot])->value : NULL;
+}
+
+void* lru_put(void* key, void* value, lru_cache* cache){
+
+    if(key == NULL || cache == NULL)
+        return NULL;
+
+    size_t hash = mix(cache->hash(key));
+    long slot = find_slot(key, hash, cache);
+
+    // replace the value of an existing entry.
+    if(slot >= 0){
+        lru_entry* entry = entry_of(pl_move_first(cache->index[slot], cache->order));
+        void* old_value = entry->value;
+        entry->value = value;
+        return old_value;
+    }
+
+    pl_pos* pos;
+
+    if(size(cache->order) >= cache->capacity){
+
+        // recycle the position and entry of the least recently used entry.
+        pos = last(cache->order);
+        lru_entry* victim = entry_of(pos);
+        remove_slot(find_slot(victim->key, victim->hash, cache), cache);
+
+        if(cache->evict != NULL)
+            cache->evict(victim->key, victim->value, cache->evict_ctx);
+
+        pl_move_first(pos, cache->order);
+    }
+    else{
+
+        lru_entry* entry = malloc(sizeof(lru_entry));
+
+        if(entry == NULL)
+            return NULL;
+
+        pos = add_first(entry, cache->order);
+
+        if(pos == NULL){
+            free(entry);
+            return NULL;
+        }
+    }
+
+    lru_entry* entry = entry_of(pos);
+    entry->key = key;
+    entry->value = value;
+    entry->hash = hash;
+    insert_slot(pos, cache);
+
+    return NULL;
+}
+
+void* lru_remove(void* key, lru_cache* cache){
+
+    if(key == NULL || cache == NULL)
+        return NULL;
+
+    long slot = find_slot(key, mix(cache->hash(key)), cache);
+
+    if(slot < 0)
+        return NULL;
+
+    pl_pos* pos = cache->index[slot];
+    remove_slot(slot, cache);
+
+    lru_entry* entry = delete(pos, cache->order);
+    void* value = entry->value;
+    free(entry);
+
+    return value;
+}
+
+uint lru_size(lru_cache* cache){
+    return cache != NULL ? size(cache->order) : 0;
+}
+
+////////////////////// END OF LRU CACHE FUNCTIONS //////////////////////
+
+
+////////////////////// SHARDED LRU CACHE FUNCTIONS //////////////////////
+
+/**
+ * @brief Returns the shard a key belongs to. The high bits of the mixed hash are used, since
+ * the low bits pick the slot inside the shard's index.
+ */
+static inline uint shard_of(void* key, lru_sharded* cache){
+    return (uint) ((mix(cache->hash(key)) >> 32) % cache->num_shards);
+}
+
+lru_sharded* init_lru_sharded(uint num_shards, uint capacity, lru_hash hash, lru_equals equals, lru_evict evict, void* ctx){
+
+    if(num_shards == 0 || capacity < num_shards || hash == NULL || equals == NULL)
+        return NULL;
+
+    lru_sharded* cache = malloc(sizeof(lru_sharded));
+
+    if(cache == NULL)
+        return NULL;
+
+    cache->shards = calloc(num_shards, sizeof(lru_cache*));
+    cache->locks = malloc(num_shards * sizeof(pthread_mutex_t));
+    cache->num_shards = num_shards;
+    cache->hash = hash;
+
+    if(cache->shards == NULL || cache->locks == NULL){
+        free(cache->shards);
+        free(cache->locks);
+        free(cache);
+        return NULL;
+    }
+
+    for(uint i=0; i<num_shards; ++i){
+
+        // spread the remainder of the capacity over the first shards.
+        uint shard_cap = capacity / num_shards + (i < capacity % num_shards ? 1 : 0);
+        cache->shards[i] = init_lru(shard_cap, hash, equals, evict, ctx);
+        pthread_mutex_init(&cache->locks[i], NULL);
+
+        if(cache->shards[i] == NULL){
+            cache->num_shards = i + 1;
+            return destroy_lru_sharded(cache);
+        }
+    }
+
+    return cache;
+}
+
+lru_sharded* destroy_lru_sharded(lru_sharded* cache){
+
+    if(cache != NULL){
+
+        for(uint i=0; i<cache->num_shards; ++i){
+            destroy_lru(cache->shards[i]);
+            pthread_mutex_destroy(&cache->locks[i]);
+        }
+
+        free(cache->shards);
+        free(cache->locks);
+        free(cache);
+    }
+
+    return NULL;
+}
+
+void* lru_sh_get(void* key, lru_sharded* cache){
+
+    if(key == NULL || cache == NULL)
+        return NULL;
+
+    uint shard = shard_of(key, cache);
+
+    pthread_mutex_lock(&cache->locks[shard]);
+    void* value = lru_get(key, cache->shards[shard]);
+    pthread_mutex_unlock(&cache->locks[shard]);
+
+    return value;
+}
+
+void* lru_sh_put(void* key, void* value, lru_sharded* cache){
+
+    if(key == NULL || cache == NULL)
+        return NULL;
+
+    uint shard = shard_of(key, cache);
+
+    pthread_mutex_lock(&cache->locks[shard]);
+    void* old_value = lru_put(key, value, cache->shards[shard]);
+    pthread_mutex_unlock(&cache->locks[shard]);
+
+    return old_value;
+}
+
+void* lru_sh_remove(void* key, lru_sharded* cache){
+
+    if(key == NULL || cache == NULL)
+        return NULL;
+
+    uint shard = shard_of(key, cache);
+
+    pthread_mutex_lock(&cache->locks[shard]);
+    void* value = lru_remove(key, cache->shards[shard]);
+    pthread_mutex_unlock(&cache->locks[shard]);
+
+    return value;
+}
+
+uint lru_sh_size(lru_sharded* cache){
+
+    uint total = 0;
+
+    if(cache != NULL){
+        for(uint i=0; i<cache->num_shards; ++i){
+            pthread_mutex_lock(&cache->locks[i]);
+            total += lru_size(cache->shards[i]);
+            pthread_mutex_unlock(&cache->locks[i]);
+        }
+    }
+
+    return total;
+}
+
+////////////////////// END OF SHARDED LRU CACHE FUNCTIONS //////////////////////
+
+
+////////////////////// HASH FUNCTIONS //////////////////////
+
+size_t lru_str_hash(void* key){
+    return (size_t) fnv_hash(FNV_OFFSET_BASIS,key,strlen(key));
+}
+
+BOOL lru_str_equals(void* key_a, void* key_b){
+    return strcmp((string) key_a, (string) key_b) == 0 ? TRUE : FALSE;
+}
+
+size_t lru_long_hash(void* key){
+    return (size_t) *(long*) key;
+}
+
+BOOL lru_long_equals(void* key_a, void* key_b){
+    return *(long*) key_a == *(long*) key_b ? TRUE : FALSE;
+}
+
+////////////////////// END OF HASH FUNCTIONS //////////////////////
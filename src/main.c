@@ -1,8 +1,50 @@
 #include "../include/general_tree.h"
+#include "../include/lru_cache.h"
 
 /// @brief Indicates that the program terminated successfully.
 #define SUCCESS 0
 
+/// @brief Indicates that a self-check failed.
+#define FAILURE 1
+
+static size_t long_key_hash(void* key){
+    return (size_t) *(long*) key;
+}
+
+static BOOL long_key_equals(void* key_a, void* key_b){
+    return *(long*) key_a == *(long*) key_b ? TRUE : FALSE;
+}
+
+/**
+ * @brief Removes enough entries from a full cache of 4 to make it rebuild its index, which
+ * must not keep the removed or recycled positions, then looks up every key.
+ * @param num_puts The number of keys put, 0 to num_puts - 1.
+ * @param first_removed The first of the keys removed, up to the last key put.
+ * @return true if only the keys still cached are found.
+ */
+static bool lru_rebuild_check(long num_puts, long first_removed){
+
+    long keys[8];
+    lru_cache* cache = init_lru(4,long_key_hash,long_key_equals,NULL,NULL);
+    bool ok = cache != NULL;
+
+    for(long i=0; ok && i<num_puts; ++i){
+        keys[i] = i;
+        lru_put(&keys[i],&keys[i],cache);
+    }
+
+    for(long i=first_removed; ok && i<num_puts; ++i)
+        ok = lru_remove(&keys[i],cache) == &keys[i];
+
+    for(long i=0; ok && i<num_puts; ++i){
+        bool cached = i >= num_puts - 4 && i < first_removed;
+        ok = lru_get(&keys[i],cache) == (cached ? &keys[i] : NULL);
+    }
+
+    destroy_lru(cache);
+    return ok;
+}
+
 /**
  * @brief The entry point of the program.
  * @param argc The number of command line arguments passed to the
@@ -30,5 +72,10 @@ int main(int argc, char* argv[]){
     gt_pos_str_print(root);
     gt_pos_str_print(c2);
 
+    if(!lru_rebuild_check(4,1) || !lru_rebuild_check(8,4)){
+        fprintf(stderr,"%s\n","LRU cache index check failed.");
+        return FAILURE;
+    }
+
     return SUCCESS;
 }
\ No newline at end of file
@@ -0,0 +1,662 @@
+/**
+ * @brief This mapped_list.c file contains the implementations of the functions that access
+ * and manipulate the "mm_list" struct.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#define _GNU_SOURCE
+#include "../include/mapped_list.h"
+#include "../include/fnv_hash.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+
+/// @brief Identifies a complete journal: "DSAMJRNL".
+#define JOURNAL_MAGIC 0x4c4e524a4d415344ULL
+
+/// @brief The number of bytes the journal is written in at once.
+#define JOURNAL_CHUNK (1UL << 20)
+
+static const char MAGIC[8] = {'D','S','A','M','L','I','S','T'};
+
+/**
+ * @brief The start of the journal. It is followed by "num_pages" records, each the offset of
+ * a page in the file and then the page.
+ */
+typedef struct journal_header{
+
+    uint64_t magic;
+    uint64_t num_pages;
+    uint64_t page_size;
+
+    /// @brief The checksum of the records, so that a partly written journal is detected.
+    uint64_t checksum;
+
+} journal_header;
+
+
+////////////////////// FILE HELPERS //////////////////////
+
+/**
+ * @brief Writes a buffer completely at an offset of a file.
+ */
+static BOOL write_all(int fd, const void* buf, size_t n, off_t offset){
+
+    const unsigned char* bytes = buf;
+
+    while(n > 0){
+        ssize_t done = pwrite(fd,bytes,n,offset);
+        if(done <= 0)
+            return FALSE;
+        bytes += done;
+        n -= done;
+        offset += done;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Reads a buffer completely from an offset of a file.
+ */
+static BOOL read_all(int fd, void* buf, size_t n, off_t offset){
+
+    unsigned char* bytes = buf;
+
+    while(n > 0){
+        ssize_t done = pread(fd,bytes,n,offset);
+        if(done <= 0)
+            return FALSE;
+        bytes += done;
+        n -= done;
+        offset += done;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Completes the checkpoint recorded in a journal, or discards the journal if it was not
+ * completely written.
+ * @return false if the file could not be read or written.
+ */
+static BOOL recover(int fd, int journal_fd){
+
+    struct stat st;
+    journal_header jh;
+
+    if(fstat(journal_fd,&st) != 0)
+        return FALSE;
+
+    if((size_t) st.st_size < sizeof(journal_header))
+        return ftruncate(journal_fd,0) == 0 ? TRUE : FALSE;
+
+    if(read_all(journal_fd,&jh,sizeof(jh),0) == FALSE)
+        return FALSE;
+
+    size_t record = sizeof(uint64_t) + jh.page_size;
+    BOOL complete = jh.magic == JOURNAL_MAGIC && jh.page_size > 0 && jh.page_size % 8 == 0 && jh.page_size <= JOURNAL_CHUNK && jh.num_pages <= (st.st_size - sizeof(jh)) / record;
+
+    unsigned char* buffer = complete ? malloc(record) : NULL;
+    uint64_t h = FNV_OFFSET_BASIS;
+
+    // the records are checked before any of them is written into the file.
+    for(uint64_t i=0; buffer != NULL && i<jh.num_pages; ++i){
+        if(read_all(journal_fd,buffer,record,sizeof(jh) + i * record) == FALSE){
+            free(buffer);
+            return FALSE;
+        }
+        h = fnv_hash(h,buffer,record);
+    }
+
+    if(buffer != NULL && h == jh.checksum){
+
+        for(uint64_t i=0; i<jh.num_pages; ++i){
+
+            uint64_t offset;
+            BOOL ok = read_all(journal_fd,buffer,record,sizeof(jh) + i * record);
+
+            if(ok == TRUE){
+                memcpy(&offset,buffer,sizeof(offset));
+                ok = write_all(fd,buffer + sizeof(offset),jh.page_size,offset);
+            }
+
+            if(ok == FALSE){
+                free(buffer);
+                return FALSE;
+            }
+        }
+
+        if(fdatasync(fd) != 0){
+            free(buffer);
+            return FALSE;
+        }
+    }
+
+    free(buffer);
+    return (ftruncate(journal_fd,0) == 0 && fdatasync(journal_fd) == 0) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Writes the header of an empty list into a new, empty file, then extends the file.
+ * The header is synced first, so that a file whose creation was interrupted is either still
+ * empty or starts with the header, and is never a run of zeros mistaken for a list.
+ */
+static BOOL create(int fd, uint elem_size){
+
+    mm_header h;
+    memset(&h,0,sizeof(h));
+    memcpy(h.magic,MAGIC,sizeof(MAGIC));
+    h.format = MM_FORMAT;
+    h.elem_size = elem_size;
+    h.node_size = sizeof(mm_pos) + ((elem_size + 7) & ~7UL);
+    h.file_size = MM_INITIAL_SIZE;
+    h.bump = MM_DATA_START;
+    h.free_head = MM_NULL;
+    h.head = MM_NULL;
+    h.tail = MM_NULL;
+
+    while(h.file_size < MM_DATA_START + h.node_size)
+        h.file_size += MM_INITIAL_SIZE;
+
+    return (write_all(fd,&h,sizeof(h),0) == TRUE && fdatasync(fd) == 0 && ftruncate(fd,h.file_size) == 0 && fdatasync(fd) == 0) ? TRUE : FALSE;
+}
+
+////////////////////// END OF FILE HELPERS //////////////////////
+
+
+////////////////////// MAPPING HELPERS //////////////////////
+
+static inline mm_header* header(mm_list* list){
+    return (mm_header*) list->base;
+}
+
+static inline mm_pos* node(mm_list* list, mm_off off){
+    return (mm_pos*) (list->base + off);
+}
+
+/**
+ * @brief Checks that an offset is a position of the list that was not freed.
+ */
+static BOOL is_position(mm_list* list, mm_off off){
+
+    mm_header* h = header(list);
+
+    return (off >= MM_DATA_START && off < h->bump && (off - MM_DATA_START) % h->node_size == 0 && node(list,off)->prev != MM_FREED) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Makes room to record the pages of one change, so that marking them cannot fail
+ * half way through the change.
+ */
+static BOOL reserve_dirty(mm_list* list){
+
+    // the header's page and the pages of three positions.
+    size_t needed = list->num_dirty + 1 + 3 * (header(list)->node_size / list->page_size + 2);
+
+    if(needed <= list->dirty_cap)
+        return TRUE;
+
+    size_t cap = list->dirty_cap > 0 ? 2 * list->dirty_cap : 256;
+    while(cap < needed)
+        cap *= 2;
+
+    uint64_t* pages = realloc(list->dirty_pages,cap * sizeof(uint64_t));
+
+    if(pages == NULL)
+        return FALSE;
+
+    list->dirty_pages = pages;
+    list->dirty_cap = cap;
+    return TRUE;
+}
+
+/**
+ * @brief Records that the bytes [off, off + len) are about to change.
+ */
+static void mark(mm_list* list, uint64_t off, uint64_t len){
+
+    for(uint64_t p = off / list->page_size; p <= (off + len - 1) / list->page_size; ++p){
+        if((list->dirty_bits[p >> 3] & (1u << (p & 7))) == 0){
+            list->dirty_bits[p >> 3] |= 1u << (p & 7);
+            list->dirty_pages[list->num_dirty++] = p;
+        }
+    }
+}
+
+static inline void mark_node(mm_list* list, mm_off off){
+    mark(list,off,header(list)->node_size);
+}
+
+/**
+ * @brief Grows the file and its mapping, which may move.
+ */
+static BOOL grow(mm_list* list){
+
+    uint64_t old_size = header(list)->file_size;
+    uint64_t growth = old_size < MM_MAX_GROWTH ? old_size : MM_MAX_GROWTH;
+    uint64_t new_size = old_size + growth;
+
+    while(new_size < header(list)->bump + header(list)->node_size)
+        new_size += MM_INITIAL_SIZE;
+
+    size_t old_bits = (old_size / list->page_size + 7) / 8;
+    size_t new_bits = (new_size / list->page_size + 7) / 8;
+    uint8_t* bits = realloc(list->dirty_bits,new_bits);
+
+    if(bits == NULL)
+        return FALSE;
+
+    memset(bits + old_bits,0,new_bits - old_bits);
+    list->dirty_bits = bits;
+
+    if(ftruncate(list->fd,new_size) != 0)
+        return FALSE;
+
+    void* base = mremap(list->base,old_size,new_size,MREMAP_MAYMOVE);
+
+    if(base == MAP_FAILED)
+        return FALSE;
+
+    list->base = base;
+    header(list)->file_size = new_size;
+    return TRUE;
+}
+
+/**
+ * @brief Takes a position from the list of freed positions, or from the end of the used
+ * space.
+ * @return the position, or MM_NULL if the file could not grow.
+ */
+static mm_off alloc_node(mm_list* list){
+
+    mm_header* h = header(list);
+    mm_off off = h->free_head;
+
+    if(off != MM_NULL){
+        mark_node(list,off);
+        h->free_head = node(list,off)->next;
+        return off;
+    }
+
+    if(h->bump + h->node_size > h->file_size && grow(list) == FALSE)
+        return MM_NULL;
+
+    h = header(list);
+    off = h->bump;
+    h->bump += h->node_size;
+    mark_node(list,off);
+    return off;
+}
+
+/**
+ * @brief Adds a copy of an element between two adjacent positions, either of which may be
+ * MM_NULL at an end of the list.
+ */
+static mm_off add_between(mm_list* list, mm_off prev, mm_off next, const void* elem_ptr){
+
+    if(reserve_dirty(list) == FALSE)
+        return MM_NULL;
+
+    mark(list,0,sizeof(mm_header));
+
+    mm_off off = alloc_node(list);
+
+    if(off == MM_NULL)
+        return MM_NULL;
+
+    mm_header* h = header(list);
+    mm_pos* pos = node(list,off);
+
+    memcpy(pos->data,elem_ptr,h->elem_size);
+    pos->prev = prev;
+    pos->next = next;
+
+    if(prev != MM_NULL){
+        mark_node(list,prev);
+        node(list,prev)->next = off;
+    }
+    else
+        h->head = off;
+
+    if(next != MM_NULL){
+        mark_node(list,next);
+        node(list,next)->prev = off;
+    }
+    else
+        h->tail = off;
+
+    ++(h->num_elements);
+    return off;
+}
+
+static int compare_pages(const void* a, const void* b){
+    uint64_t x = *(const uint64_t*) a;
+    uint64_t y = *(const uint64_t*) b;
+    return (x > y) - (x < y);
+}
+
+////////////////////// END OF MAPPING HELPERS //////////////////////
+
+
+////////////////////// MAPPED LIST FUNCTIONS //////////////////////
+
+mm_list* mm_open(const char* path, uint elem_size){
+
+    if(path == NULL)
+        return NULL;
+
+    int fd = open(path,O_RDWR | O_CREAT,0644);
+
+    if(fd < 0)
+        return NULL;
+
+    char* journal_path = malloc(strlen(path) + sizeof(".journal"));
+    int journal_fd = -1;
+
+    if(journal_path != NULL && flock(fd,LOCK_EX | LOCK_NB) == 0){
+        strcpy(journal_path,path);
+        strcat(journal_path,".journal");
+        journal_fd = open(journal_path,O_RDWR | O_CREAT,0644);
+    }
+
+    free(journal_path);
+
+    mm_header h;
+    struct stat st;
+    mm_list* list = NULL;
+    size_t page_size = (size_t) sysconf(_SC_PAGESIZE);
+
+    if(journal_fd < 0 || recover(fd,journal_fd) == FALSE || fstat(fd,&st) != 0)
+        goto fail;
+
+    // only an empty file gets a new list; any other file must already hold one.
+    if(st.st_size == 0 && (elem_size == 0 || create(fd,elem_size) == FALSE || fstat(fd,&st) != 0))
+        goto fail;
+
+    if(st.st_size < (off_t) sizeof(h) || read_all(fd,&h,sizeof(h),0) == FALSE)
+        goto fail;
+
+    // a creation interrupted after the header was written is completed.
+    if(memcmp(h.magic,MAGIC,sizeof(MAGIC)) == 0 && h.checkpoints == 0 && h.bump == MM_DATA_START && h.file_size > (uint64_t) st.st_size){
+        if(ftruncate(fd,h.file_size) != 0 || fdatasync(fd) != 0 || fstat(fd,&st) != 0)
+            goto fail;
+    }
+
+    if(memcmp(h.magic,MAGIC,sizeof(MAGIC)) != 0 || h.format != MM_FORMAT || h.elem_size == 0 || (elem_size != 0 && h.elem_size != elem_size)
+       || h.node_size != sizeof(mm_pos) + ((h.elem_size + 7) & ~7UL) || h.file_size % page_size != 0 || h.file_size > (uint64_t) st.st_size
+       || h.bump < MM_DATA_START || h.bump > h.file_size || (h.bump - MM_DATA_START) % h.node_size != 0)
+        goto fail;
+
+    list = malloc(sizeof(mm_list));
+
+    if(list == NULL)
+        goto fail;
+
+    list->fd = fd;
+    list->journal_fd = journal_fd;
+    list->page_size = page_size;
+    list->dirty_bits = calloc((h.file_size / page_size + 7) / 8,1);
+    list->dirty_pages = NULL;
+    list->num_dirty = 0;
+    list->dirty_cap = 0;
+    list->base = mmap(NULL,h.file_size,PROT_READ | PROT_WRITE,MAP_PRIVATE,fd,0);
+
+    if(list->dirty_bits == NULL || list->base == MAP_FAILED){
+        if(list->base != MAP_FAILED)
+            munmap(list->base,h.file_size);
+        free(list->dirty_bits);
+        free(list);
+        goto fail;
+    }
+
+    return list;
+
+fail:
+    if(journal_fd >= 0)
+        close(journal_fd);
+    close(fd);
+    return NULL;
+}
+
+BOOL mm_close(mm_list* list){
+
+    if(list == NULL)
+        return FALSE;
+
+    // the list is closed even if the checkpoint fails, leaving the file as of the last one.
+    BOOL saved = mm_checkpoint(list);
+
+    munmap(list->base,header(list)->file_size);
+    close(list->journal_fd);
+    close(list->fd);
+    free(list->dirty_bits);
+    free(list->dirty_pages);
+    free(list);
+    return saved;
+}
+
+BOOL mm_checkpoint(mm_list* list){
+
+    if(list == NULL)
+        return FALSE;
+
+    if(list->num_dirty == 0 || reserve_dirty(list) == FALSE)
+        return list->num_dirty == 0 ? TRUE : FALSE;
+
+    mark(list,0,sizeof(mm_header));
+    ++(header(list)->checkpoints);
+
+    size_t ps = list->page_size;
+    size_t record = sizeof(uint64_t) + ps;
+    unsigned char* chunk = malloc(JOURNAL_CHUNK);
+
+    if(chunk == NULL || ftruncate(list->journal_fd,0) != 0){
+        free(chunk);
+        return FALSE;
+    }
+
+    qsort(list->dirty_pages,list->num_dirty,sizeof(uint64_t),compare_pages);
+
+    // 1. the changed pages go to the journal, which is synced before the file is touched.
+    journal_header jh = {JOURNAL_MAGIC,list->num_dirty,ps,FNV_OFFSET_BASIS};
+    off_t journal_off = sizeof(jh);
+    size_t used = 0;
+
+    for(size_t i=0; i<=list->num_dirty; ++i){
+
+        if(i == list->num_dirty || used + record > JOURNAL_CHUNK){
+            jh.checksum = fnv_hash(jh.checksum,chunk,used);
+            if(write_all(list->journal_fd,chunk,used,journal_off) == FALSE){
+                free(chunk);
+                return FALSE;
+            }
+            journal_off += used;
+            used = 0;
+        }
+
+        if(i < list->num_dirty){
+            uint64_t offset = list->dirty_pages[i] * ps;
+            memcpy(chunk + used,&offset,sizeof(offset));
+            memcpy(chunk + used + sizeof(offset),list->base + offset,ps);
+            used += record;
+        }
+    }
+
+    free(chunk);
+
+    if(write_all(list->journal_fd,&jh,sizeof(jh),0) == FALSE || fdatasync(list->journal_fd) != 0)
+        return FALSE;
+
+    // 2. the pages go to the file, a run of consecutive pages at a time.
+    for(size_t i=0, j; i<list->num_dirty; i = j){
+
+        for(j = i + 1; j < list->num_dirty && list->dirty_pages[j] == list->dirty_pages[j - 1] + 1; ++j);
+
+        uint64_t offset = list->dirty_pages[i] * ps;
+        if(write_all(list->fd,list->base + offset,(j - i) * ps,offset) == FALSE)
+            return FALSE;
+    }
+
+    if(fdatasync(list->fd) != 0)
+        return FALSE;
+
+    // 3. the checkpoint is complete once the journal is empty again.
+    if(ftruncate(list->journal_fd,0) != 0 || fdatasync(list->journal_fd) != 0)
+        return FALSE;
+
+    // the private copies of the pages now equal the file, so they are dropped and the
+    // mapping reads the file again.
+    for(size_t i=0, j; i<list->num_dirty; i = j){
+        for(j = i + 1; j < list->num_dirty && list->dirty_pages[j] == list->dirty_pages[j - 1] + 1; ++j);
+        madvise(list->base + list->dirty_pages[i] * ps,(j - i) * ps,MADV_DONTNEED);
+    }
+
+    for(size_t i=0; i<list->num_dirty; ++i)
+        list->dirty_bits[list->dirty_pages[i] >> 3] = 0;
+
+    list->num_dirty = 0;
+    return TRUE;
+}
+
+unsigned long mm_size(mm_list* list){
+    return (list != NULL) ? header(list)->num_elements : 0;
+}
+
+BOOL mm_is_empty(mm_list* list){
+    return (mm_size(list) == 0) ? TRUE : FALSE;
+}
+
+uint mm_elem_size(mm_list* list){
+    return (list != NULL) ? header(list)->elem_size : 0;
+}
+
+mm_off mm_first(mm_list* list){
+    return (list != NULL) ? header(list)->head : MM_NULL;
+}
+
+mm_off mm_last(mm_list* list){
+    return (list != NULL) ? header(list)->tail : MM_NULL;
+}
+
+mm_off mm_after(mm_list* list, mm_off pos){
+    return (list != NULL && is_position(list,pos) == TRUE) ? node(list,pos)->next : MM_NULL;
+}
+
+mm_off mm_before(mm_list* list, mm_off pos){
+    return (list != NULL && is_position(list,pos) == TRUE) ? node(list,pos)->prev : MM_NULL;
+}
+
+const void* mm_get(mm_list* list, mm_off pos){
+    return (list != NULL && is_position(list,pos) == TRUE) ? node(list,pos)->data : NULL;
+}
+
+BOOL mm_set(mm_list* list, mm_off pos, const void* elem_ptr){
+
+    if(list == NULL || elem_ptr == NULL || is_position(list,pos) == FALSE || reserve_dirty(list) == FALSE)
+        return FALSE;
+
+    mark_node(list,pos);
+    memcpy(node(list,pos)->data,elem_ptr,header(list)->elem_size);
+    return TRUE;
+}
+
+mm_off mm_add_first(mm_list* list, const void* elem_ptr){
+
+    if(list == NULL || elem_ptr == NULL)
+        return MM_NULL;
+
+    return add_between(list,MM_NULL,header(list)->head,elem_ptr);
+}
+
+mm_off mm_add_last(mm_list* list, const void* elem_ptr){
+
+    if(list == NULL || elem_ptr == NULL)
+        return MM_NULL;
+
+    return add_between(list,header(list)->tail,MM_NULL,elem_ptr);
+}
+
+mm_off mm_add_before(mm_list* list, mm_off pos, const void* elem_ptr){
+
+    if(list == NULL || elem_ptr == NULL || is_position(list,pos) == FALSE)
+        return MM_NULL;
+
+    return add_between(list,node(list,pos)->prev,pos,elem_ptr);
+}
+
+mm_off mm_add_after(mm_list* list, mm_off pos, const void* elem_ptr){
+
+    if(list == NULL || elem_ptr == NULL || is_position(list,pos) == FALSE)
+        return MM_NULL;
+
+    return add_between(list,pos,node(list,pos)->next,elem_ptr);
+}
+
+BOOL mm_delete(mm_list* list, mm_off pos, void* elem_ptr){
+
+    if(list == NULL || is_position(list,pos) == FALSE || reserve_dirty(list) == FALSE)
+        return FALSE;
+
+    mm_header* h = header(list);
+    mm_pos* p = node(list,pos);
+
+    mark(list,0,sizeof(mm_header));
+    mark_node(list,pos);
+
+    if(elem_ptr != NULL)
+        memcpy(elem_ptr,p->data,h->elem_size);
+
+    if(p->prev != MM_NULL){
+        mark_node(list,p->prev);
+        node(list,p->prev)->next = p->next;
+    }
+    else
+        h->head = p->next;
+
+    if(p->next != MM_NULL){
+        mark_node(list,p->next);
+        node(list,p->next)->prev = p->prev;
+    }
+    else
+        h->tail = p->prev;
+
+    // the position goes to the front of the list of freed positions.
+    p->prev = MM_FREED;
+    p->next = h->free_head;
+    h->free_head = pos;
+    --(h->num_elements);
+    return TRUE;
+}
+
+void mm_for_each(mm_list* list, ptr_visit func, void* ctx){
+
+    if(list == NULL || func == NULL)
+        return;
+
+    for(mm_off off = header(list)->head; off != MM_NULL; off = node(list,off)->next)
+        func(node(list,off)->data,ctx);
+}
+
+uint mm_append_p_list(mm_list* list, p_list* src){
+
+    if(list == NULL || src == NULL)
+        return 0;
+
+    uint count = 0;
+
+    for(pl_cursor cur = pl_cursor_begin(src); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur)){
+        if(mm_add_last(list,pl_cursor_get(&cur)) == MM_NULL)
+            break;
+        ++count;
+    }
+
+    return count;
+}
+
+////////////////////// END OF MAPPED LIST FUNCTIONS //////////////////////
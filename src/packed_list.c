@@ -0,0 +1,353 @@
+/**
+ * @brief This packed_list.c file contains the implementations of the functions that access
+ * and manipulate the "pk_list" struct.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/packed_list.h"
+#include <limits.h>
+
+////////////////////// ENCODING HELPERS //////////////////////
+
+/**
+ * @brief Maps a difference to an unsigned value that is small when the difference is near 0,
+ * whatever its sign: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+ */
+static inline uint64_t zigzag(long prev, long value){
+    uint64_t delta = (uint64_t) value - (uint64_t) prev;
+    return (delta << 1) ^ (uint64_t) ((int64_t) delta >> 63);
+}
+
+/**
+ * @brief Adds a zigzag encoded difference to the value before it.
+ */
+static inline long unzigzag(long prev, uint64_t zz){
+    uint64_t delta = (zz >> 1) ^ (0 - (zz & 1));
+    return (long) ((uint64_t) prev + delta);
+}
+
+/**
+ * @brief Writes a value as a varint, 7 bits per byte with the high bit set on every byte but
+ * the last.
+ * @return the number of bytes written.
+ */
+static inline uint write_varint(uint8_t* out, uint64_t x){
+
+    uint n = 0;
+
+    while(x >= 0x80){
+        out[n++] = (uint8_t) (x | 0x80);
+        x >>= 7;
+    }
+
+    out[n++] = (uint8_t) x;
+    return n;
+}
+
+/**
+ * @brief Reads a varint and advances the offset past it.
+ */
+static inline uint64_t read_varint(const uint8_t* bytes, uint* offset){
+
+    uint64_t x = 0;
+    uint shift = 0;
+    uint8_t b;
+
+    do{
+        b = bytes[(*offset)++];
+        x |= (uint64_t) (b & 0x7f) << shift;
+        shift += 7;
+    }while(b & 0x80);
+
+    return x;
+}
+
+/**
+ * @brief Decodes the first "count" values of a block into an array.
+ */
+static void decode_block(pk_list* list, pk_block* block, long* out, uint count){
+
+    if(count == 0)
+        return;
+
+    uint offset = block->offset;
+    long value = block->first;
+    out[0] = value;
+
+    for(uint i=1; i<count; ++i){
+        value = unzigzag(value,read_varint(list->bytes,&offset));
+        out[i] = value;
+    }
+}
+
+////////////////////// END OF ENCODING HELPERS //////////////////////
+
+
+////////////////////// PACKED LIST FUNCTIONS //////////////////////
+
+pk_list* init_pk_list(){
+
+    pk_list* list = malloc(sizeof(pk_list));
+
+    if(list != NULL){
+        list->blocks = NULL;
+        list->num_blocks = 0;
+        list->blocks_cap = 0;
+        list->bytes = NULL;
+        list->num_bytes = 0;
+        list->bytes_cap = 0;
+        list->num_elements = 0;
+        list->last = 0;
+        list->sorted = TRUE;
+    }
+
+    return list;
+}
+
+pk_list* destroy_pk_list(pk_list* list){
+
+    if(list != NULL){
+        free(list->blocks);
+        free(list->bytes);
+        free(list);
+    }
+
+    return NULL;
+}
+
+uint pk_size(pk_list* list){
+    return (list != NULL) ? list->num_elements : 0;
+}
+
+BOOL pk_is_sorted(pk_list* list){
+    return (list != NULL) ? list->sorted : TRUE;
+}
+
+BOOL pk_append(pk_list* list, long value){
+
+    if(list == NULL || list->num_elements == UINT_MAX)
+        return FALSE;
+
+    pk_block* block = list->num_blocks > 0 ? &list->blocks[list->num_blocks - 1] : NULL;
+
+    // a full block, or none, means the value starts a new block.
+    if(block == NULL || block->count == PK_BLOCK_VALUES){
+
+        if(list->num_blocks == list->blocks_cap){
+            uint cap = list->blocks_cap > 0 ? 2 * list->blocks_cap : 4;
+            pk_block* blocks = realloc(list->blocks,cap * sizeof(pk_block));
+            if(blocks == NULL)
+                return FALSE;
+            list->blocks = blocks;
+            list->blocks_cap = cap;
+        }
+
+        block = &list->blocks[list->num_blocks++];
+        block->first = block->min = block->max = value;
+        block->offset = list->num_bytes;
+        block->count = 0;
+    }
+    else{
+
+        if(list->bytes_cap - list->num_bytes < PK_MAX_VARINT){
+
+            // offsets into the bytes are 32-bit, so the array stops growing at UINT_MAX bytes.
+            if(list->num_bytes > UINT_MAX - PK_MAX_VARINT)
+                return FALSE;
+
+            uint cap = list->bytes_cap == 0 ? 256 : list->bytes_cap > UINT_MAX / 2 ? UINT_MAX : 2 * list->bytes_cap;
+            uint8_t* bytes = realloc(list->bytes,cap);
+            if(bytes == NULL)
+                return FALSE;
+            list->bytes = bytes;
+            list->bytes_cap = cap;
+        }
+
+        list->num_bytes += write_varint(list->bytes + list->num_bytes,zigzag(list->last,value));
+
+        if(value < block->min)
+            block->min = value;
+        if(value > block->max)
+            block->max = value;
+    }
+
+    if(list->num_elements > 0 && value < list->last)
+        list->sorted = FALSE;
+
+    ++(block->count);
+    ++(list->num_elements);
+    list->last = value;
+    return TRUE;
+}
+
+BOOL pk_get(pk_list* list, uint i, long* value){
+
+    if(list == NULL || value == NULL || i >= list->num_elements)
+        return FALSE;
+
+    // every block but the last is full, so the block of an index is found by division.
+    pk_block* block = &list->blocks[i / PK_BLOCK_VALUES];
+    uint offset = block->offset;
+    long v = block->first;
+
+    for(uint j = i % PK_BLOCK_VALUES; j > 0; --j)
+        v = unzigzag(v,read_varint(list->bytes,&offset));
+
+    *value = v;
+    return TRUE;
+}
+
+pk_iter pk_iter_begin(pk_list* list){
+    (void) list;
+    pk_iter iter = {0,0,0,0};
+    return iter;
+}
+
+BOOL pk_iter_next(pk_iter* iter, pk_list* list, long* value){
+
+    if(iter == NULL || list == NULL || value == NULL)
+        return FALSE;
+
+    // move on from a finished block, unless it is the last one, which may still grow.
+    if(iter->block < list->num_blocks && iter->index == list->blocks[iter->block].count){
+        if(iter->block + 1 == list->num_blocks)
+            return FALSE;
+        ++(iter->block);
+        iter->index = 0;
+    }
+
+    if(iter->block >= list->num_blocks)
+        return FALSE;
+
+    pk_block* block = &list->blocks[iter->block];
+
+    if(iter->index == 0){
+        iter->value = block->first;
+        iter->offset = block->offset;
+    }
+    else
+        iter->value = unzigzag(iter->value,read_varint(list->bytes,&iter->offset));
+
+    ++(iter->index);
+    *value = iter->value;
+    return TRUE;
+}
+
+uint pk_decode(pk_list* list, uint start, long* out, uint n){
+
+    if(list == NULL || out == NULL || start >= list->num_elements)
+        return 0;
+
+    if(n > list->num_elements - start)
+        n = list->num_elements - start;
+
+    uint done = 0;
+    long buffer[PK_BLOCK_VALUES];
+
+    while(done < n){
+
+        uint i = start + done;
+        pk_block* block = &list->blocks[i / PK_BLOCK_VALUES];
+        uint skip = i % PK_BLOCK_VALUES;
+        uint take = block->count - skip < n - done ? block->count - skip : n - done;
+
+        // whole blocks are decoded straight into the output.
+        if(skip == 0 && take == block->count)
+            decode_block(list,block,out + done,take);
+        else{
+            decode_block(list,block,buffer,skip + take);
+            for(uint j=0; j<take; ++j)
+                out[done + j] = buffer[skip + j];
+        }
+
+        done += take;
+    }
+
+    return n;
+}
+
+long pk_find(pk_list* list, long value){
+
+    if(list == NULL)
+        return -1;
+
+    long buffer[PK_BLOCK_VALUES];
+
+    for(uint b=0; b<list->num_blocks; ++b){
+
+        pk_block* block = &list->blocks[b];
+
+        if(value < block->min || value > block->max)
+            continue;
+
+        decode_block(list,block,buffer,block->count);
+
+        for(uint j=0; j<block->count; ++j){
+            if(buffer[j] == value)
+                return (long) b * PK_BLOCK_VALUES + j;
+        }
+    }
+
+    return -1;
+}
+
+long pk_lower_bound(pk_list* list, long value){
+
+    if(list == NULL || list->sorted == FALSE)
+        return -1;
+
+    // find the first block whose largest value is not less than the value.
+    uint lo = 0;
+    uint hi = list->num_blocks;
+
+    while(lo < hi){
+        uint mid = lo + (hi - lo) / 2;
+        if(list->blocks[mid].max < value)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if(lo == list->num_blocks)
+        return list->num_elements;
+
+    pk_block* block = &list->blocks[lo];
+    long buffer[PK_BLOCK_VALUES];
+    decode_block(list,block,buffer,block->count);
+
+    uint j = 0;
+    while(buffer[j] < value)
+        ++j;
+
+    return (long) lo * PK_BLOCK_VALUES + j;
+}
+
+pk_list* pk_from_p_list(p_list* list){
+
+    if(list == NULL)
+        return NULL;
+
+    pk_list* packed = init_pk_list();
+
+    if(packed == NULL)
+        return NULL;
+
+    for(pl_cursor cur = pl_cursor_begin(list); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur)){
+        if(pk_append(packed,*(long*) pl_cursor_get(&cur)) == FALSE)
+            return destroy_pk_list(packed);
+    }
+
+    return packed;
+}
+
+size_t pk_memory_usage(pk_list* list){
+
+    if(list == NULL)
+        return 0;
+
+    return sizeof(pk_list) + list->blocks_cap * sizeof(pk_block) + list->bytes_cap;
+}
+
+////////////////////// END OF PACKED LIST FUNCTIONS //////////////////////
@@ -0,0 +1,329 @@
+/**
+ * @brief This pl_parallel.c file contains the implementations of the functions that scan a
+ * positional list on the threads of a "pl_pool".
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/pl_parallel.h"
+#include <stdint.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+////////////////////// SCAN HELPERS //////////////////////
+
+/**
+ * @brief The kinds of scans.
+ */
+typedef enum pl_job_kind{
+    PL_JOB_FOR_EACH,
+    PL_JOB_COUNT_IF,
+    PL_JOB_FIND_ANY
+} pl_job_kind;
+
+/**
+ * @brief A scan: the ranges to process, the next range to hand out, the function to apply
+ * and the combined result.
+ */
+typedef struct pl_job{
+
+    /// @brief The first position of every range, followed by the end of the last range.
+    pl_pos** splits;
+
+    /// @brief The number of ranges.
+    uint num_ranges;
+
+    /// @brief The index of the next range to hand out.
+    atomic_uint next_range;
+
+    pl_job_kind kind;
+    ptr_visit visit;
+    ptr_predicate pred;
+    void* ctx;
+
+    /// @brief The number of elements that passed the test, for PL_JOB_COUNT_IF.
+    atomic_uint count;
+
+    /// @brief The position found, for PL_JOB_FIND_ANY.
+    _Atomic(pl_pos*) found;
+
+} pl_job;
+
+/**
+ * @brief Takes ranges of a scan until there are none left, or until another thread found
+ * what a PL_JOB_FIND_ANY scan looks for.
+ */
+static void run_job(pl_job* job){
+
+    for(;;){
+
+        uint r = atomic_fetch_add_explicit(&job->next_range,1,memory_order_relaxed);
+
+        if(r >= job->num_ranges)
+            return;
+
+        pl_cursor cur = pl_cursor_at(job->splits[r],job->splits[r + 1],FALSE);
+
+        switch(job->kind){
+
+            case PL_JOB_FOR_EACH:
+                for(; pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur))
+                    job->visit(pl_cursor_get(&cur),job->ctx);
+                break;
+
+            case PL_JOB_COUNT_IF:{
+                uint count = 0;
+                for(; pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur))
+                    count += job->pred(pl_cursor_get(&cur),job->ctx) == TRUE ? 1 : 0;
+                atomic_fetch_add_explicit(&job->count,count,memory_order_relaxed);
+                break;
+            }
+
+            case PL_JOB_FIND_ANY:
+                for(; pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur)){
+
+                    // the flag is only written once, so reading it costs a cache hit.
+                    if(atomic_load_explicit(&job->found,memory_order_relaxed) != NULL)
+                        return;
+
+                    if(job->pred(pl_cursor_get(&cur),job->ctx) == TRUE){
+                        pl_pos* expected = NULL;
+                        atomic_compare_exchange_strong(&job->found,&expected,pl_cursor_pos(&cur));
+                        return;
+                    }
+                }
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Makes sure the list's cached split points describe "num_ranges" ranges of its
+ * current layout. Range i starts at index floor(i * n / num_ranges).
+ * @return false if memory could not be allocated.
+ */
+static BOOL refresh_splits(p_list* list, uint num_ranges){
+
+    if(list->splits != NULL && list->splits_version == list->version && list->num_splits == num_ranges)
+        return TRUE;
+
+    if(list->num_splits != num_ranges || list->splits == NULL){
+        pl_pos** splits = realloc(list->splits,(num_ranges + 1) * sizeof(pl_pos*));
+        if(splits == NULL)
+            return FALSE;
+        list->splits = splits;
+        list->num_splits = num_ranges;
+    }
+
+    uint n = list->num_elements;
+
+    if(list->rank != NULL){
+        for(uint i=0; i<num_ranges; ++i)
+            list->splits[i] = pl_at(list,(uint) ((uint64_t) i * n / num_ranges));
+    }
+    else{
+        // one pass that records the position at every range boundary.
+        pl_pos* pos = list->header->next_ptr;
+        uint index = 0;
+
+        for(uint i=0; i<num_ranges; ++i){
+            uint start = (uint) ((uint64_t) i * n / num_ranges);
+            for(; index < start; ++index)
+                pos = pos->next_ptr;
+            list->splits[i] = pos;
+        }
+    }
+
+    list->splits[num_ranges] = list->trailer;
+    list->splits_version = list->version;
+    return TRUE;
+}
+
+/**
+ * @brief Runs a scan over a list: on the calling thread alone for short lists or without a
+ * pool, and otherwise on the pool and the calling thread together.
+ */
+static void run_scan(p_list* list, pl_job* job, pl_pool* pool){
+
+    pl_pos* whole[2] = {list->header->next_ptr,list->trailer};
+    uint num_threads = pool != NULL ? pool->num_threads + 1 : 1;
+    uint num_ranges = PL_PARALLEL_RANGES_PER_THREAD * num_threads;
+
+    atomic_init(&job->next_range,0);
+    atomic_init(&job->count,0);
+    atomic_init(&job->found,NULL);
+
+    if(pool == NULL || pool->num_threads == 0 || list->num_elements < PL_PARALLEL_MIN_ELEMENTS){
+        job->splits = whole;
+        job->num_ranges = 1;
+        run_job(job);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->run_lock);
+
+    if(refresh_splits(list,num_ranges) == TRUE){
+        job->splits = list->splits;
+        job->num_ranges = num_ranges;
+    }
+    else{
+        job->splits = whole;
+        job->num_ranges = 1;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->job = job;
+    ++(pool->generation);
+    pool->active = pool->num_threads;
+    pthread_cond_broadcast(&pool->work_posted);
+    pthread_mutex_unlock(&pool->lock);
+
+    run_job(job);
+
+    // the job lives on this thread's stack, so wait until every worker has left it.
+    pthread_mutex_lock(&pool->lock);
+    while(pool->active > 0)
+        pthread_cond_wait(&pool->work_done,&pool->lock);
+    pool->job = NULL;
+    pthread_mutex_unlock(&pool->lock);
+
+    pthread_mutex_unlock(&pool->run_lock);
+}
+
+////////////////////// END OF SCAN HELPERS //////////////////////
+
+
+////////////////////// THREAD POOL FUNCTIONS //////////////////////
+
+/**
+ * @brief The loop of a worker thread: join every posted scan once, until the pool stops.
+ */
+static void* pool_worker(void* arg){
+
+    pl_pool* pool = arg;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    for(;;){
+
+        while(pool->stop == FALSE && pool->generation == seen)
+            pthread_cond_wait(&pool->work_posted,&pool->lock);
+
+        if(pool->stop == TRUE)
+            break;
+
+        seen = pool->generation;
+        pl_job* job = pool->job;
+        pthread_mutex_unlock(&pool->lock);
+
+        run_job(job);
+
+        pthread_mutex_lock(&pool->lock);
+        if(--(pool->active) == 0)
+            pthread_cond_signal(&pool->work_done);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+pl_pool* init_pl_pool(uint num_threads){
+
+    if(num_threads == 0){
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = online > 1 ? (uint) (online - 1) : 0;
+    }
+
+    pl_pool* pool = malloc(sizeof(pl_pool));
+
+    if(pool == NULL)
+        return NULL;
+
+    pool->threads = malloc((num_threads > 0 ? num_threads : 1) * sizeof(pthread_t));
+
+    if(pool->threads == NULL){
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->run_lock,NULL);
+    pthread_mutex_init(&pool->lock,NULL);
+    pthread_cond_init(&pool->work_posted,NULL);
+    pthread_cond_init(&pool->work_done,NULL);
+    pool->job = NULL;
+    pool->generation = 0;
+    pool->active = 0;
+    pool->stop = FALSE;
+    pool->num_threads = 0;
+
+    for(uint i=0; i<num_threads; ++i){
+
+        if(pthread_create(&pool->threads[i],NULL,pool_worker,pool) != 0)
+            return destroy_pl_pool(pool);
+
+        ++(pool->num_threads);
+    }
+
+    return pool;
+}
+
+pl_pool* destroy_pl_pool(pl_pool* pool){
+
+    if(pool != NULL){
+
+        pthread_mutex_lock(&pool->lock);
+        pool->stop = TRUE;
+        pthread_cond_broadcast(&pool->work_posted);
+        pthread_mutex_unlock(&pool->lock);
+
+        for(uint i=0; i<pool->num_threads; ++i)
+            pthread_join(pool->threads[i],NULL);
+
+        pthread_mutex_destroy(&pool->run_lock);
+        pthread_mutex_destroy(&pool->lock);
+        pthread_cond_destroy(&pool->work_posted);
+        pthread_cond_destroy(&pool->work_done);
+        free(pool->threads);
+        free(pool);
+    }
+
+    return NULL;
+}
+
+////////////////////// END OF THREAD POOL FUNCTIONS //////////////////////
+
+
+////////////////////// PARALLEL FUNCTIONS //////////////////////
+
+void pl_parallel_for_each(p_list* list, ptr_visit func, void* ctx, pl_pool* pool){
+
+    if(list == NULL || func == NULL || is_empty(list) == TRUE)
+        return;
+
+    pl_job job = {.kind = PL_JOB_FOR_EACH, .visit = func, .ctx = ctx};
+    run_scan(list,&job,pool);
+}
+
+uint pl_parallel_count_if(p_list* list, ptr_predicate pred, void* ctx, pl_pool* pool){
+
+    if(list == NULL || pred == NULL || is_empty(list) == TRUE)
+        return 0;
+
+    pl_job job = {.kind = PL_JOB_COUNT_IF, .pred = pred, .ctx = ctx};
+    run_scan(list,&job,pool);
+    return atomic_load(&job.count);
+}
+
+pl_pos* pl_parallel_find_any(p_list* list, ptr_predicate pred, void* ctx, pl_pool* pool){
+
+    if(list == NULL || pred == NULL || is_empty(list) == TRUE)
+        return NULL;
+
+    pl_job job = {.kind = PL_JOB_FIND_ANY, .pred = pred, .ctx = ctx};
+    run_scan(list,&job,pool);
+    return atomic_load(&job.found);
+}
+
+////////////////////// END OF PARALLEL FUNCTIONS //////////////////////
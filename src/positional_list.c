@@ -8,6 +8,85 @@
 
 
 #include "../include/positional_list.h"
+#include <stdint.h>
+#include <limits.h>
+
+/**
+ * @brief Deallocates a position that has been unlinked from the list. Positions that live
+ * in the list's arena are only counted, the arena itself is freed with its last position.
+ * @param pos The position to be deallocated.
+ * @param list The positional list the position belonged to.
+ */
+static void free_pl_pos(pl_pos* pos, p_list* list){
+
+    uintptr_t addr = (uintptr_t) pos;
+    uintptr_t start = (uintptr_t) list->arena;
+
+    if(list->arena != NULL && addr >= start && addr < start + list->arena_len * sizeof(pl_pos)){
+        if(--(list->arena_live) == 0){
+            free(list->arena);
+            list->arena = NULL;
+            list->arena_len = 0;
+        }
+    }
+    else
+        free(pos);
+}
+
+/**
+ * @brief Releases the handle of a position that is being deleted, so that it no longer
+ * resolves, and drops the position's entry from the side table. Its rank id must already
+ * have been removed from the rank index.
+ */
+static void release_pl_handle(pl_pos* pos, p_list* list){
+
+    st_entry* entry = st_find(list->side,pos);
+
+    if(entry == NULL)
+        return;
+
+    if(entry->handle != H_NULL)
+        h_release(list->handles,entry->handle);
+
+    st_remove(list->side,pos);
+}
+
+/**
+ * @brief Drops the list's rank index, and the side table with it unless handles need it.
+ */
+static void drop_rank(p_list* list){
+
+    list->rank = destroy_r_index(list->rank);
+
+    if(list->handles == NULL)
+        list->side = destroy_s_table(list->side);
+}
+
+/**
+ * @brief Enters a position that was just linked into the list in the list's rank index,
+ * after its predecessor. The rank index is dropped if it or the side table cannot grow.
+ */
+static void rank_link(pl_pos* pos, p_list* list){
+
+    if(list->rank != NULL){
+
+        // every position already in the index has an entry in the side table.
+        uint after = pos->prev_ptr != list->header ? st_find(list->side,pos->prev_ptr)->rank_id : R_NIL;
+        st_entry* entry = st_insert(list->side,pos);
+
+        if(entry == NULL || (entry->rank_id = ri_insert_after(list->rank,after,pos)) == R_NIL)
+            drop_rank(list);
+    }
+}
+
+/**
+ * @brief Removes a position from the list's rank index.
+ */
+static void rank_unlink(pl_pos* pos, p_list* list){
+
+    if(list->rank != NULL)
+        ri_remove(list->rank,st_find(list->side,pos)->rank_id);
+}
 
 ////////////////////// POSITION FUNCTIONS //////////////////////
 
@@ -48,6 +127,19 @@ p_list* init_p_list(){
     // initialize the number of elements in the list.
     list->num_elements = 0;
 
+    // positions are allocated individually until the list is compacted.
+    list->arena = NULL;
+    list->arena_len = list->arena_live = 0;
+
+    // handles are only created once they are enabled.
+    list->handles = NULL;
+    list->side = NULL;
+    list->rank = NULL;
+    list->version = 0;
+    list->splits = NULL;
+    list->num_splits = 0;
+    list->splits_version = 0;
+
     // check if enough space is allocated before returning the list.
     if(list != NULL && list->header != NULL && list->trailer != NULL)
         return list;
@@ -57,37 +149,52 @@ p_list* init_p_list(){
 
 p_list* destroy_p_list(p_list* list){
 
-    if(list != NULL && is_empty(list) == FALSE){
+    // a single step without a limit frees the whole list.
+    pl_destroy_step(list,UINT_MAX);
+    return NULL;
+}
 
-        // get the first position in the list.
-        pl_pos* curr_pos = get_header(list)->next_ptr;
+BOOL pl_destroy_step(p_list* list, uint max_nodes){
 
-        pl_pos* next_pos = NULL;
+    if(list == NULL)
+        return TRUE;
 
-        while(curr_pos != NULL){
+    // the rank index goes first, so that it is not updated for positions about to be freed.
+    drop_rank(list);
 
-            // move the next position
-            next_pos = after(curr_pos,list);
+    pl_pos* header = get_header(list);
+    pl_pos* trailer = get_trailer(list);
+    uint freed = 0;
 
-            // delete this position
-            delete(curr_pos,list);
+    // a budget of 0 still makes progress, so that a loop of steps always ends.
+    if(max_nodes == 0)
+        max_nodes = 1;
 
-            // update curr_pos to reference the next position
-            curr_pos = next_pos;
-        }
+    // unlink and free positions from the front, releasing their handles so that they do not
+    // resolve to freed positions between steps.
+    while(header->next_ptr != trailer && freed < max_nodes){
+        pl_pos* pos = header->next_ptr;
+        header->next_ptr = pos->next_ptr;
+        release_pl_handle(pos,list);
+        free_pl_pos(pos,list);
+        --(list->num_elements);
+        ++freed;
+    }
 
-        // delete the header sentinel
-        free(list->header);
-        // delete the trailer sentinel
-        free(list->trailer);
-        list->header = list->trailer = NULL;
-        list->num_elements = 0;
-        // delete the list
-        free(list);
-        list = NULL;                
+    if(header->next_ptr != trailer){
+        header->next_ptr->prev_ptr = header;
+        ++(list->version);
+        return FALSE;
     }
 
-    return NULL;
+    // delete the sentinels, the handle table, the cached split points and the list.
+    free(list->header);
+    free(list->trailer);
+    list->handles = destroy_h_table(list->handles);
+    list->side = destroy_s_table(list->side);
+    free(list->splits);
+    free(list);
+    return TRUE;
 }
 
 BOOL is_header(pl_pos* pos, p_list* list){
@@ -171,6 +278,8 @@ pl_pos* add_first(void* elem_ptr,p_list* list){
             next_pos->prev_ptr = new_pos;
             header->next_ptr = new_pos;            
             ++(list->num_elements);
+            ++(list->version);
+            rank_link(new_pos,list);
             return new_pos;
         }                    
     }
@@ -195,6 +304,8 @@ pl_pos* add_last(void* elem_ptr, p_list* list){
             prev_pos->next_ptr = new_pos;
             trailer->prev_ptr = new_pos;
             ++(list->num_elements);
+            ++(list->version);
+            rank_link(new_pos,list);
             return new_pos;
         }
     }
@@ -216,6 +327,8 @@ pl_pos* add_before(pl_pos* pos,void* elem_ptr,p_list* list){
         prev_pos->next_ptr = new_pos;
         pos->prev_ptr = new_pos;
         ++(list->num_elements);
+        ++(list->version);
+        rank_link(new_pos,list);
         return new_pos;
     }
     else if(is_header(pos,list) == TRUE)
@@ -238,6 +351,8 @@ pl_pos* add_after(pl_pos* pos,void* elem_ptr,p_list* list){
         next_pos->prev_ptr = new_pos;
         pos->next_ptr = new_pos;
         ++(list->num_elements);
+        ++(list->version);
+        rank_link(new_pos,list);
         return new_pos;
     }
     else if(is_trailer(pos,list) == TRUE)
@@ -246,6 +361,64 @@ pl_pos* add_after(pl_pos* pos,void* elem_ptr,p_list* list){
     return NULL;
 }
 
+pl_pos* pl_move_first(pl_pos* pos, p_list* list){
+
+    if(pos != NULL && list != NULL && is_header(pos,list) == FALSE && is_trailer(pos,list) == FALSE){
+
+        pl_pos* header = get_header(list);
+
+        if(header->next_ptr != pos){
+            rank_unlink(pos,list);
+
+            // unlink the position from its neighbors.
+            pos->prev_ptr->next_ptr = pos->next_ptr;
+            pos->next_ptr->prev_ptr = pos->prev_ptr;
+
+            // link it in after the header.
+            pos->next_ptr = header->next_ptr;
+            pos->prev_ptr = header;
+            header->next_ptr->prev_ptr = pos;
+            header->next_ptr = pos;
+
+            rank_link(pos,list);
+            ++(list->version);
+        }
+
+        return pos;
+    }
+
+    return NULL;
+}
+
+pl_pos* pl_move_last(pl_pos* pos, p_list* list){
+
+    if(pos != NULL && list != NULL && is_header(pos,list) == FALSE && is_trailer(pos,list) == FALSE){
+
+        pl_pos* trailer = get_trailer(list);
+
+        if(trailer->prev_ptr != pos){
+            rank_unlink(pos,list);
+
+            // unlink the position from its neighbors.
+            pos->prev_ptr->next_ptr = pos->next_ptr;
+            pos->next_ptr->prev_ptr = pos->prev_ptr;
+
+            // link it in before the trailer.
+            pos->prev_ptr = trailer->prev_ptr;
+            pos->next_ptr = trailer;
+            trailer->prev_ptr->next_ptr = pos;
+            trailer->prev_ptr = pos;
+
+            rank_link(pos,list);
+            ++(list->version);
+        }
+
+        return pos;
+    }
+
+    return NULL;
+}
+
 void* set(pl_pos* pos, void* elem_ptr, p_list* list){
     
     if(pos != NULL && list != NULL && is_header(pos,list) == FALSE && is_trailer(pos,list) == FALSE){
@@ -262,6 +435,8 @@ void* delete(pl_pos* pos, p_list* list){
     
     if(pos != NULL && list != NULL && is_header(pos,list) == FALSE && is_trailer(pos,list) == FALSE){
 
+        rank_unlink(pos,list);
+
         // get its previous neighbor
         pl_pos* prev_pos = before(pos,list);        
         // get its next neighbor
@@ -272,10 +447,13 @@ void* delete(pl_pos* pos, p_list* list){
         pos->next_ptr = NULL;
         pos->prev_ptr = NULL;        
         void* elem_ptr = pos->data_ptr;
+        // a deleted position's handle must not resolve any more.
+        release_pl_handle(pos,list);
         // deallocate the memory allocated to this position.
         pos->data_ptr = NULL;        
-        free(pos);
+        free_pl_pos(pos,list);
         --(list->num_elements);
+        ++(list->version);
         return elem_ptr;
     }
     else if((is_header(pos,list) == TRUE || is_trailer(pos,list) == TRUE) && is_empty(list) == TRUE)
@@ -300,9 +478,382 @@ void print_p_list(p_list* list, ptr_print func){
         func(list);
 }
 
+void pl_for_each(p_list* list, ptr_visit func, void* ctx){
+
+    if(list != NULL && func != NULL){
+
+        for(pl_cursor cur = pl_cursor_begin(list); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur))
+            func(pl_cursor_get(&cur), ctx);
+    }
+}
+
+void pl_for_each_reverse(p_list* list, ptr_visit func, void* ctx){
+
+    if(list != NULL && func != NULL){
+
+        for(pl_cursor cur = pl_cursor_rbegin(list); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur))
+            func(pl_cursor_get(&cur), ctx);
+    }
+}
+
+BOOL pl_compact(p_list* list, ptr_remap func, void* ctx){
+
+    if(list == NULL)
+        return FALSE;
+
+    if(is_empty(list) == TRUE)
+        return TRUE;
+
+    uint n = list->num_elements;
+    pl_pos* block = malloc(n * sizeof(pl_pos));
+
+    if(block == NULL)
+        return FALSE;
+
+    pl_pos* old_first = list->header->next_ptr;
+    pl_pos* prev_pos = list->header;
+    pl_pos* curr = old_first;
+
+    // copy the positions into the block in list order, linking each to its predecessor.
+    for(uint i=0; i<n; ++i){
+
+        block[i].data_ptr = curr->data_ptr;
+        block[i].prev_ptr = prev_pos;
+        prev_pos->next_ptr = &block[i];
+        prev_pos = &block[i];
+
+        if(func != NULL)
+            func(curr,&block[i],ctx);
+
+        // point the position's handle, rank index node and side table entry at its new address.
+        st_entry* entry = st_find(list->side,curr);
+        if(entry != NULL){
+            if(entry->handle != H_NULL)
+                h_relocate(list->handles,entry->handle,&block[i]);
+            if(list->rank != NULL)
+                ri_set_item(list->rank,entry->rank_id,&block[i]);
+            st_relocate(list->side,curr,&block[i]);
+        }
+
+        curr = curr->next_ptr;
+    }
+
+    block[n-1].next_ptr = list->trailer;
+    list->trailer->prev_ptr = &block[n-1];
+
+    // free the old positions; their "next_ptr" links still describe the old order.
+    pl_pos* old_arena = list->arena;
+    uint old_arena_len = list->arena_len;
+    uintptr_t start = (uintptr_t) old_arena;
+    curr = old_first;
+
+    for(uint i=0; i<n; ++i){
+
+        pl_pos* next_pos = curr->next_ptr;
+        uintptr_t addr = (uintptr_t) curr;
+
+        if(old_arena == NULL || addr < start || addr >= start + old_arena_len * sizeof(pl_pos))
+            free(curr);
+
+        curr = next_pos;
+    }
+
+    free(old_arena);
+
+    list->arena = block;
+    list->arena_len = list->arena_live = n;
+    ++(list->version);
+    return TRUE;
+}
+
 ////////////////////// END OF POSITIONAL LIST FUNCTIONS //////////////////////
 
 
+////////////////////// HANDLE FUNCTIONS //////////////////////
+
+BOOL pl_enable_handles(p_list* list){
+
+    if(list == NULL)
+        return FALSE;
+
+    if(list->handles != NULL)
+        return TRUE;
+
+    list->handles = init_h_table();
+
+    // a list with a rank index already has a side table.
+    if(list->side == NULL)
+        list->side = init_s_table();
+
+    if(list->handles == NULL || list->side == NULL){
+        list->handles = destroy_h_table(list->handles);
+        if(list->rank == NULL)
+            list->side = destroy_s_table(list->side);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+pl_pos* pl_h_resolve(h_handle handle, p_list* list){
+    return list != NULL ? h_resolve(list->handles,handle) : NULL;
+}
+
+h_handle pl_get_handle(pl_pos* pos, p_list* list){
+
+    if(pos == NULL || list == NULL || list->handles == NULL || is_header(pos,list) == TRUE || is_trailer(pos,list) == TRUE)
+        return H_NULL;
+
+    st_entry* entry = st_insert(list->side,pos);
+
+    if(entry == NULL)
+        return H_NULL;
+
+    // an entry that holds nothing else is not kept without a handle.
+    if(entry->handle == H_NULL && (entry->handle = h_alloc(list->handles,pos)) == H_NULL){
+        if(list->rank == NULL)
+            st_remove(list->side,pos);
+        return H_NULL;
+    }
+
+    return entry->handle;
+}
+
+/**
+ * @brief Issues a handle for a newly added position, removing the position again if the
+ * handle table is full.
+ */
+static h_handle issue_pl_handle(pl_pos* pos, p_list* list){
+
+    if(pos == NULL)
+        return H_NULL;
+
+    st_entry* entry = st_insert(list->side,pos);
+    h_handle handle = entry != NULL ? h_alloc(list->handles,pos) : H_NULL;
+
+    if(handle == H_NULL){
+        delete(pos,list);
+        return H_NULL;
+    }
+
+    entry->handle = handle;
+    return handle;
+}
+
+h_handle pl_h_add_first(void* elem_ptr, p_list* list){
+
+    if(list == NULL || list->handles == NULL)
+        return H_NULL;
+
+    return issue_pl_handle(add_first(elem_ptr,list),list);
+}
+
+h_handle pl_h_add_last(void* elem_ptr, p_list* list){
+
+    if(list == NULL || list->handles == NULL)
+        return H_NULL;
+
+    return issue_pl_handle(add_last(elem_ptr,list),list);
+}
+
+h_handle pl_h_add_before(h_handle handle, void* elem_ptr, p_list* list){
+
+    pl_pos* pos = pl_h_resolve(handle,list);
+
+    if(pos == NULL)
+        return H_NULL;
+
+    return issue_pl_handle(add_before(pos,elem_ptr,list),list);
+}
+
+h_handle pl_h_add_after(h_handle handle, void* elem_ptr, p_list* list){
+
+    pl_pos* pos = pl_h_resolve(handle,list);
+
+    if(pos == NULL)
+        return H_NULL;
+
+    return issue_pl_handle(add_after(pos,elem_ptr,list),list);
+}
+
+void* pl_h_delete(h_handle handle, p_list* list){
+
+    pl_pos* pos = pl_h_resolve(handle,list);
+
+    if(pos == NULL)
+        return NULL;
+
+    return delete(pos,list);
+}
+
+////////////////////// END OF HANDLE FUNCTIONS //////////////////////
+
+
+////////////////////// RANK FUNCTIONS //////////////////////
+
+BOOL pl_enable_rank(p_list* list){
+
+    if(list == NULL)
+        return FALSE;
+
+    if(list->rank != NULL)
+        return TRUE;
+
+    list->rank = init_r_index();
+
+    if(list->side == NULL)
+        list->side = init_s_table();
+
+    if(list->rank == NULL || list->side == NULL)
+        drop_rank(list);
+
+    // enter the positions in list order, each after the one before it.
+    for(pl_pos* pos = list->header->next_ptr; pos != list->trailer && list->rank != NULL; pos = pos->next_ptr)
+        rank_link(pos,list);
+
+    return list->rank != NULL ? TRUE : FALSE;
+}
+
+pl_pos* pl_at(p_list* list, uint k){
+
+    if(list == NULL || k >= list->num_elements)
+        return NULL;
+
+    if(list->rank != NULL)
+        return ri_item(list->rank,ri_select(list->rank,k));
+
+    // walk from the nearer end.
+    pl_pos* pos;
+
+    if(k < list->num_elements / 2){
+        pos = list->header->next_ptr;
+        for(uint i=0; i<k; ++i)
+            pos = pos->next_ptr;
+    }
+    else{
+        pos = list->trailer->prev_ptr;
+        for(uint i = list->num_elements - 1; i>k; --i)
+            pos = pos->prev_ptr;
+    }
+
+    return pos;
+}
+
+long pl_index_of(pl_pos* pos, p_list* list){
+
+    if(pos == NULL || list == NULL || is_header(pos,list) == TRUE || is_trailer(pos,list) == TRUE)
+        return -1;
+
+    if(list->rank != NULL)
+        return ri_rank(list->rank,st_find(list->side,pos)->rank_id);
+
+    long index = 0;
+    for(pl_pos* curr = pos->prev_ptr; curr != list->header; curr = curr->prev_ptr)
+        ++index;
+
+    return index;
+}
+
+////////////////////// END OF RANK FUNCTIONS //////////////////////
+
+
+////////////////////// GENERATOR //////////////////////
+
+pl_gen pl_gen_begin(p_list* list){
+
+    pl_gen gen = {list != NULL ? list->header->next_ptr : NULL};
+    return gen;
+}
+
+uint pl_gen_next_n(pl_gen* gen, p_list* list, void** out, uint n){
+
+    if(gen == NULL || list == NULL || out == NULL)
+        return 0;
+
+    uint count = 0;
+    pl_pos* trailer = list->trailer;
+    pl_pos* curr = gen->next;
+
+    while(count < n && curr != trailer){
+        out[count++] = curr->data_ptr;
+        curr = curr->next_ptr;
+    }
+
+    gen->next = curr;
+    return count;
+}
+
+BOOL pl_gen_done(pl_gen* gen, p_list* list){
+    return (gen == NULL || list == NULL || gen->next == list->trailer) ? TRUE : FALSE;
+}
+
+BOOL pl_gen_save(pl_gen* gen, p_list* list, h_handle* token){
+
+    if(gen == NULL || list == NULL || list->handles == NULL || token == NULL)
+        return FALSE;
+
+    if(gen->next == list->trailer){
+        *token = H_NULL;
+        return TRUE;
+    }
+
+    *token = pl_get_handle(gen->next,list);
+    return *token != H_NULL ? TRUE : FALSE;
+}
+
+BOOL pl_gen_resume(pl_gen* gen, h_handle token, p_list* list){
+
+    if(gen == NULL || list == NULL)
+        return FALSE;
+
+    if(token == H_NULL){
+        gen->next = list->trailer;
+        return TRUE;
+    }
+
+    pl_pos* pos = pl_h_resolve(token,list);
+
+    if(pos == NULL)
+        return FALSE;
+
+    gen->next = pos;
+    return TRUE;
+}
+
+////////////////////// END OF GENERATOR //////////////////////
+
+
+////////////////////// MEMORY FUNCTIONS //////////////////////
+
+BOOL pl_memory_usage(p_list* list, pl_mem_usage* usage){
+
+    if(list == NULL || usage == NULL)
+        return FALSE;
+
+    uint n = list->num_elements;
+    uint arena_live = list->arena != NULL ? list->arena_live : 0;
+    uint arena_len = list->arena != NULL ? list->arena_len : 0;
+
+    usage->payload_bytes = n * sizeof(void*);
+    usage->node_overhead_bytes = n * (sizeof(pl_pos) - sizeof(void*));
+    usage->sentinel_bytes = 2 * sizeof(pl_pos);
+    usage->handle_bytes = list->handles != NULL ? sizeof(h_table) + list->handles->capacity * sizeof(h_slot) : 0;
+    usage->side_bytes = st_bytes(list->side);
+    usage->rank_bytes = list->rank != NULL ? sizeof(r_index) + list->rank->capacity * sizeof(r_node) : 0;
+    usage->list_bytes = sizeof(p_list) + (list->splits != NULL ? (list->num_splits + 1) * sizeof(pl_pos*) : 0);
+    usage->dead_arena_bytes = (arena_len - arena_live) * sizeof(pl_pos);
+
+    // the list, its sentinels, the positions allocated one by one, the block and the two
+    // allocations of the handle table, of the rank index and of the side table, and the split points.
+    usage->num_allocations = 3 + (n - arena_live) + (list->arena != NULL ? 1 : 0) + (list->handles != NULL ? 2 : 0) + (list->rank != NULL ? 2 : 0) + (list->side != NULL ? 2 : 0) + (list->splits != NULL ? 1 : 0);
+
+    usage->total_bytes = usage->payload_bytes + usage->node_overhead_bytes + usage->sentinel_bytes + usage->handle_bytes + usage->rank_bytes + usage->side_bytes + usage->list_bytes + usage->dead_arena_bytes;
+    return TRUE;
+}
+
+////////////////////// END OF MEMORY FUNCTIONS //////////////////////
+
+
 ////////////////////// SEARCH FUNCTIONS //////////////////////
 
 pl_pos* str_search(string elem_ptr, p_list* list){
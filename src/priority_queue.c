@@ -0,0 +1,224 @@
+/**
+ * @brief This priority_queue.c file contains the implementations of the functions that
+ * access and manipulate the "pq_pos" and "p_queue" structs.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/priority_queue.h"
+
+////////////////////// HEAP HELPERS //////////////////////
+
+/**
+ * @brief Stores an entry at index i of the heap array and records the index in its position.
+ */
+static inline void place(p_queue* pq, uint i, pq_entry entry){
+    pq->heap[i] = entry;
+    entry.pos->index = i;
+}
+
+/**
+ * @brief Moves the entry at index i towards the root until its parent's key is not greater.
+ */
+static void sift_up(p_queue* pq, uint i){
+
+    pq_entry entry = pq->heap[i];
+
+    while(i > 0){
+        uint parent = (i - 1) / pq->arity;
+        if(pq->heap[parent].key <= entry.key)
+            break;
+        place(pq,i,pq->heap[parent]);
+        i = parent;
+    }
+
+    place(pq,i,entry);
+}
+
+/**
+ * @brief Moves the entry at index i towards the leaves until none of its children has a
+ * smaller key.
+ */
+static void sift_down(p_queue* pq, uint i){
+
+    pq_entry entry = pq->heap[i];
+    uint n = pq->num_elements;
+
+    while(TRUE){
+
+        uint first_child = i * pq->arity + 1;
+        if(first_child >= n)
+            break;
+
+        // find the child with the smallest key.
+        uint last_child = first_child + pq->arity < n ? first_child + pq->arity : n;
+        uint min_child = first_child;
+        for(uint c=first_child+1; c<last_child; ++c){
+            if(pq->heap[c].key < pq->heap[min_child].key)
+                min_child = c;
+        }
+
+        if(pq->heap[min_child].key >= entry.key)
+            break;
+
+        place(pq,i,pq->heap[min_child]);
+        i = min_child;
+    }
+
+    place(pq,i,entry);
+}
+
+/**
+ * @brief Removes the entry at index i by moving the last entry into its place.
+ */
+static void* remove_at(p_queue* pq, uint i){
+
+    pq_pos* pos = pq->heap[i].pos;
+    void* elem_ptr = pos->data_ptr;
+    uint last_index = --(pq->num_elements);
+
+    if(i != last_index){
+        place(pq,i,pq->heap[last_index]);
+
+        // the moved entry may belong above or below index i.
+        if(i > 0 && pq->heap[(i - 1) / pq->arity].key > pq->heap[i].key)
+            sift_up(pq,i);
+        else
+            sift_down(pq,i);
+    }
+
+    free(pos);
+    return elem_ptr;
+}
+
+////////////////////// END OF HEAP HELPERS //////////////////////
+
+
+////////////////////// POSITION FUNCTIONS //////////////////////
+
+void* get_pq_element(pq_pos* pos){
+    return pos != NULL ? pos->data_ptr : NULL;
+}
+
+pq_key get_pq_key(pq_pos* pos){
+    return pos != NULL ? pos->key : 0;
+}
+
+////////////////////// END OF POSITION FUNCTIONS //////////////////////
+
+
+////////////////////// PRIORITY QUEUE FUNCTIONS //////////////////////
+
+p_queue* init_pq(uint arity){
+
+    p_queue* pq = malloc(sizeof(p_queue));
+
+    if(pq != NULL){
+        pq->heap = malloc(PQ_DEFAULT_CAPACITY * sizeof(pq_entry));
+
+        if(pq->heap == NULL){
+            free(pq);
+            return NULL;
+        }
+
+        pq->capacity = PQ_DEFAULT_CAPACITY;
+        pq->num_elements = 0;
+        pq->arity = arity == 4 ? 4 : 2;
+    }
+
+    return pq;
+}
+
+p_queue* destroy_pq(p_queue* pq){
+
+    if(pq != NULL){
+
+        // deallocate the positions of the remaining entries.
+        for(uint i=0; i<pq->num_elements; ++i)
+            free(pq->heap[i].pos);
+
+        free(pq->heap);
+        pq->heap = NULL;
+        free(pq);
+    }
+
+    return NULL;
+}
+
+BOOL is_pq_empty(p_queue* pq){
+    return (pq != NULL && pq->num_elements > 0) ? FALSE : TRUE;
+}
+
+uint pq_size(p_queue* pq){
+    return pq != NULL ? pq->num_elements : 0;
+}
+
+pq_pos* pq_insert(pq_key key, void* elem_ptr, p_queue* pq){
+
+    if(pq == NULL)
+        return NULL;
+
+    // double the heap array when it is full.
+    if(pq->num_elements == pq->capacity){
+        pq_entry* heap = realloc(pq->heap, pq->capacity * 2 * sizeof(pq_entry));
+        if(heap == NULL)
+            return NULL;
+        pq->heap = heap;
+        pq->capacity *= 2;
+    }
+
+    pq_pos* pos = malloc(sizeof(pq_pos));
+
+    if(pos == NULL)
+        return NULL;
+
+    pos->data_ptr = elem_ptr;
+    pos->key = key;
+
+    uint i = pq->num_elements++;
+    place(pq,i,(pq_entry){key,pos});
+    sift_up(pq,i);
+
+    return pos;
+}
+
+pq_pos* pq_min(p_queue* pq){
+    return is_pq_empty(pq) == FALSE ? pq->heap[0].pos : NULL;
+}
+
+void* pq_remove_min(p_queue* pq){
+    return is_pq_empty(pq) == FALSE ? remove_at(pq,0) : NULL;
+}
+
+BOOL pq_decrease_key(pq_pos* pos, pq_key key, p_queue* pq){
+
+    if(pos == NULL || pq == NULL || key > pos->key)
+        return FALSE;
+
+    pos->key = key;
+    pq->heap[pos->index].key = key;
+    sift_up(pq,pos->index);
+    return TRUE;
+}
+
+void pq_replace_key(pq_pos* pos, pq_key key, p_queue* pq){
+
+    if(pos != NULL && pq != NULL){
+
+        pq_key old_key = pos->key;
+        pos->key = key;
+        pq->heap[pos->index].key = key;
+
+        if(key < old_key)
+            sift_up(pq,pos->index);
+        else
+            sift_down(pq,pos->index);
+    }
+}
+
+void* pq_remove(pq_pos* pos, p_queue* pq){
+    return (pos != NULL && pq != NULL) ? remove_at(pq,pos->index) : NULL;
+}
+
+////////////////////// END OF PRIORITY QUEUE FUNCTIONS //////////////////////
@@ -0,0 +1,239 @@
+/**
+ * @brief This rank_index.c file contains the implementations of the functions that access and
+ * manipulate the "r_index" and "r_node" structs.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/rank_index.h"
+
+/**
+ * @brief Returns the number of nodes in the subtree rooted at a node, 0 for R_NIL.
+ */
+static inline uint32_t subtree_size(r_index* index, uint32_t id){
+    return id != R_NIL ? index->nodes[id].size : 0;
+}
+
+/**
+ * @brief Draws a priority with a xorshift generator.
+ */
+static uint32_t next_priority(r_index* index){
+
+    uint32_t x = index->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    index->rng = x;
+    return x;
+}
+
+/**
+ * @brief Replaces the link from a node's parent (or the root) to the node with a link to
+ * another node.
+ */
+static void replace_child(r_index* index, uint32_t parent, uint32_t old_id, uint32_t new_id){
+
+    if(parent == R_NIL)
+        index->root = new_id;
+    else if(index->nodes[parent].left == old_id)
+        index->nodes[parent].left = new_id;
+    else
+        index->nodes[parent].right = new_id;
+
+    if(new_id != R_NIL)
+        index->nodes[new_id].parent = parent;
+}
+
+/**
+ * @brief Rotates a node above its parent, keeping the in-order sequence and the sizes.
+ */
+static void rotate_up(r_index* index, uint32_t id){
+
+    r_node* nodes = index->nodes;
+    uint32_t parent = nodes[id].parent;
+    uint32_t grand = nodes[parent].parent;
+
+    if(nodes[parent].left == id){
+        uint32_t inner = nodes[id].right;
+        nodes[parent].left = inner;
+        if(inner != R_NIL)
+            nodes[inner].parent = parent;
+        nodes[id].right = parent;
+    }
+    else{
+        uint32_t inner = nodes[id].left;
+        nodes[parent].right = inner;
+        if(inner != R_NIL)
+            nodes[inner].parent = parent;
+        nodes[id].left = parent;
+    }
+
+    replace_child(index,grand,parent,id);
+    nodes[parent].parent = id;
+
+    nodes[id].size = nodes[parent].size;
+    nodes[parent].size = 1 + subtree_size(index,nodes[parent].left) + subtree_size(index,nodes[parent].right);
+}
+
+r_index* init_r_index(){
+
+    r_index* index = malloc(sizeof(r_index));
+
+    if(index != NULL){
+
+        index->nodes = malloc(R_DEFAULT_CAPACITY * sizeof(r_node));
+
+        if(index->nodes == NULL){
+            free(index);
+            return NULL;
+        }
+
+        index->capacity = R_DEFAULT_CAPACITY;
+        index->num_used = 1;
+        index->root = R_NIL;
+        index->free_head = R_NIL;
+        index->rng = 0x2545f491u;
+    }
+
+    return index;
+}
+
+r_index* destroy_r_index(r_index* index){
+
+    if(index != NULL){
+        free(index->nodes);
+        free(index);
+    }
+
+    return NULL;
+}
+
+uint32_t ri_size(r_index* index){
+    return (index != NULL) ? subtree_size(index,index->root) : 0;
+}
+
+uint32_t ri_insert_after(r_index* index, uint32_t after, void* item){
+
+    if(index == NULL || item == NULL)
+        return R_NIL;
+
+    // take a free id, or a new one.
+    uint32_t id = index->free_head;
+
+    if(id != R_NIL)
+        index->free_head = index->nodes[id].parent;
+    else{
+        if(index->num_used == index->capacity){
+            r_node* nodes = realloc(index->nodes,2 * index->capacity * sizeof(r_node));
+            if(nodes == NULL)
+                return R_NIL;
+            index->nodes = nodes;
+            index->capacity *= 2;
+        }
+        id = index->num_used++;
+    }
+
+    r_node* nodes = index->nodes;
+    nodes[id].item = item;
+    nodes[id].left = nodes[id].right = R_NIL;
+    nodes[id].size = 1;
+    nodes[id].priority = next_priority(index);
+
+    // the successor of "after" in the sequence is the leftmost free slot of its right subtree,
+    // or its right child slot; the front is the leftmost free slot of the tree.
+    uint32_t parent = after;
+    bool as_left = false;
+
+    if(after == R_NIL){
+        parent = index->root;
+        as_left = true;
+        while(parent != R_NIL && nodes[parent].left != R_NIL)
+            parent = nodes[parent].left;
+    }
+    else if(nodes[after].right != R_NIL){
+        parent = nodes[after].right;
+        as_left = true;
+        while(nodes[parent].left != R_NIL)
+            parent = nodes[parent].left;
+    }
+
+    nodes[id].parent = parent;
+
+    if(parent == R_NIL)
+        index->root = id;
+    else if(as_left)
+        nodes[parent].left = id;
+    else
+        nodes[parent].right = id;
+
+    for(uint32_t p = parent; p != R_NIL; p = nodes[p].parent)
+        ++nodes[p].size;
+
+    // restore the heap order of the priorities.
+    while(nodes[id].parent != R_NIL && nodes[nodes[id].parent].priority < nodes[id].priority)
+        rotate_up(index,id);
+
+    return id;
+}
+
+void ri_remove(r_index* index, uint32_t id){
+
+    if(index == NULL || id == R_NIL || id >= index->num_used)
+        return;
+
+    r_node* nodes = index->nodes;
+
+    // rotate the node down, below its higher priority child, until it has at most one child.
+    while(nodes[id].left != R_NIL && nodes[id].right != R_NIL){
+        uint32_t left = nodes[id].left;
+        uint32_t right = nodes[id].right;
+        rotate_up(index,nodes[left].priority > nodes[right].priority ? left : right);
+    }
+
+    uint32_t child = nodes[id].left != R_NIL ? nodes[id].left : nodes[id].right;
+    uint32_t parent = nodes[id].parent;
+
+    replace_child(index,parent,id,child);
+
+    for(uint32_t p = parent; p != R_NIL; p = nodes[p].parent)
+        --nodes[p].size;
+
+    nodes[id].item = NULL;
+    nodes[id].parent = index->free_head;
+    index->free_head = id;
+}
+
+uint32_t ri_rank(r_index* index, uint32_t id){
+
+    r_node* nodes = index->nodes;
+    uint32_t rank = subtree_size(index,nodes[id].left);
+
+    // every ancestor that the node is right of comes before it, with its left subtree.
+    for(uint32_t p = nodes[id].parent; p != R_NIL; id = p, p = nodes[p].parent){
+        if(nodes[p].right == id)
+            rank += 1 + subtree_size(index,nodes[p].left);
+    }
+
+    return rank;
+}
+
+uint32_t ri_select(r_index* index, uint32_t k){
+
+    if(index == NULL || k >= ri_size(index))
+        return R_NIL;
+
+    uint32_t id = index->root;
+
+    for(;;){
+        uint32_t left = subtree_size(index,index->nodes[id].left);
+        if(k < left)
+            id = index->nodes[id].left;
+        else if(k == left)
+            return id;
+        else{
+            k -= left + 1;
+            id = index->nodes[id].right;
+        }
+    }
+}
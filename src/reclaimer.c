@@ -0,0 +1,165 @@
+/**
+ * @brief This reclaimer.c file contains the implementations of the functions that access and
+ * manipulate the "reclaimer" struct.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/reclaimer.h"
+#include <sched.h>
+
+////////////////////// RECLAIMER HELPERS //////////////////////
+
+/**
+ * @brief The loop of the reclaiming thread: take a structure, free it a batch at a time
+ * without holding the lock, and sleep while there is nothing to free.
+ */
+static void* reclaim_loop(void* arg){
+
+    reclaimer* rc = arg;
+
+    pthread_mutex_lock(&rc->lock);
+
+    for(;;){
+
+        while(rc->stop == FALSE && queue_size(rc->lists) == 0 && queue_size(rc->trees) == 0)
+            pthread_cond_wait(&rc->work_posted,&rc->lock);
+
+        if(queue_size(rc->lists) == 0 && queue_size(rc->trees) == 0)
+            break;
+
+        p_list* list = dequeue(rc->lists);
+        g_tree* tree = list == NULL ? dequeue(rc->trees) : NULL;
+        pthread_mutex_unlock(&rc->lock);
+
+        if(list != NULL){
+            while(pl_destroy_step(list,RC_STEP_NODES) == FALSE)
+                sched_yield();
+        }
+        else{
+            while(!gt_destroy_step(tree,RC_STEP_NODES))
+                sched_yield();
+        }
+
+        pthread_mutex_lock(&rc->lock);
+        if(--(rc->pending) == 0)
+            pthread_cond_broadcast(&rc->work_done);
+    }
+
+    pthread_mutex_unlock(&rc->lock);
+    return NULL;
+}
+
+/**
+ * @brief Queues a structure for the reclaiming thread.
+ */
+static BOOL retire(reclaimer* rc, a_queue* queue, void* ptr){
+
+    pthread_mutex_lock(&rc->lock);
+
+    BOOL added = enqueue(ptr,queue);
+    if(added == TRUE){
+        ++(rc->pending);
+        pthread_cond_signal(&rc->work_posted);
+    }
+
+    pthread_mutex_unlock(&rc->lock);
+    return added;
+}
+
+////////////////////// END OF RECLAIMER HELPERS //////////////////////
+
+
+////////////////////// RECLAIMER FUNCTIONS //////////////////////
+
+reclaimer* init_reclaimer(){
+
+    reclaimer* rc = malloc(sizeof(reclaimer));
+
+    if(rc == NULL)
+        return NULL;
+
+    rc->lists = init_queue();
+    rc->trees = init_queue();
+    rc->pending = 0;
+    rc->stop = FALSE;
+
+    if(rc->lists == NULL || rc->trees == NULL){
+        destroy_queue(rc->lists);
+        destroy_queue(rc->trees);
+        free(rc);
+        return NULL;
+    }
+
+    pthread_mutex_init(&rc->lock,NULL);
+    pthread_cond_init(&rc->work_posted,NULL);
+    pthread_cond_init(&rc->work_done,NULL);
+
+    if(pthread_create(&rc->thread,NULL,reclaim_loop,rc) != 0){
+        pthread_mutex_destroy(&rc->lock);
+        pthread_cond_destroy(&rc->work_posted);
+        pthread_cond_destroy(&rc->work_done);
+        destroy_queue(rc->lists);
+        destroy_queue(rc->trees);
+        free(rc);
+        return NULL;
+    }
+
+    return rc;
+}
+
+reclaimer* destroy_reclaimer(reclaimer* rc){
+
+    if(rc != NULL){
+
+        // the thread empties the queues before it acts on the stop flag.
+        pthread_mutex_lock(&rc->lock);
+        rc->stop = TRUE;
+        pthread_cond_signal(&rc->work_posted);
+        pthread_mutex_unlock(&rc->lock);
+
+        pthread_join(rc->thread,NULL);
+
+        pthread_mutex_destroy(&rc->lock);
+        pthread_cond_destroy(&rc->work_posted);
+        pthread_cond_destroy(&rc->work_done);
+        destroy_queue(rc->lists);
+        destroy_queue(rc->trees);
+        free(rc);
+    }
+
+    return NULL;
+}
+
+BOOL rc_retire_p_list(reclaimer* rc, p_list* list){
+    return (rc != NULL && list != NULL) ? retire(rc,rc->lists,list) : FALSE;
+}
+
+BOOL rc_retire_g_tree(reclaimer* rc, g_tree* tree){
+    return (rc != NULL && tree != NULL) ? retire(rc,rc->trees,tree) : FALSE;
+}
+
+uint rc_pending(reclaimer* rc){
+
+    if(rc == NULL)
+        return 0;
+
+    pthread_mutex_lock(&rc->lock);
+    uint pending = rc->pending;
+    pthread_mutex_unlock(&rc->lock);
+    return pending;
+}
+
+void rc_drain(reclaimer* rc){
+
+    if(rc == NULL)
+        return;
+
+    pthread_mutex_lock(&rc->lock);
+    while(rc->pending > 0)
+        pthread_cond_wait(&rc->work_done,&rc->lock);
+    pthread_mutex_unlock(&rc->lock);
+}
+
+////////////////////// END OF RECLAIMER FUNCTIONS //////////////////////
@@ -0,0 +1,167 @@
+/**
+ * @brief This side_table.c file contains the implementations of the functions that
+ * access and manipulate the "s_table" struct.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/side_table.h"
+
+/**
+ * @brief Returns the slot a position's probe sequence starts at.
+ */
+static inline uint32_t st_home(const s_table* table, const void* pos){
+
+    // positions are aligned, so the low bits carry no information and are mixed away.
+    uint64_t h = (uint64_t) (uintptr_t) pos * 0x9E3779B97F4A7C15ull;
+    return (uint32_t) (h >> 32) & (table->capacity - 1);
+}
+
+/**
+ * @brief Returns the slot holding a position, or the empty slot it would be stored in.
+ */
+static uint32_t st_probe(const s_table* table, const void* pos){
+
+    uint32_t i = st_home(table,pos);
+
+    while(table->slots[i].pos != NULL && table->slots[i].pos != pos)
+        i = (i + 1) & (table->capacity - 1);
+
+    return i;
+}
+
+/**
+ * @brief Doubles the number of slots, placing every entry again.
+ * @return true if the table grew.
+ */
+static bool st_grow(s_table* table){
+
+    st_entry* old_slots = table->slots;
+    uint32_t old_cap = table->capacity;
+    st_entry* slots = calloc((size_t) old_cap * 2,sizeof(st_entry));
+
+    if(slots == NULL)
+        return false;
+
+    table->slots = slots;
+    table->capacity = old_cap * 2;
+
+    for(uint32_t i=0; i<old_cap; ++i)
+        if(old_slots[i].pos != NULL)
+            table->slots[st_probe(table,old_slots[i].pos)] = old_slots[i];
+
+    free(old_slots);
+    return true;
+}
+
+s_table* init_s_table(){
+
+    s_table* table = malloc(sizeof(s_table));
+
+    if(table != NULL){
+        table->slots = calloc(ST_DEFAULT_CAPACITY,sizeof(st_entry));
+
+        if(table->slots == NULL){
+            free(table);
+            return NULL;
+        }
+
+        table->capacity = ST_DEFAULT_CAPACITY;
+        table->count = 0;
+    }
+
+    return table;
+}
+
+s_table* destroy_s_table(s_table* table){
+
+    if(table != NULL){
+        free(table->slots);
+        table->slots = NULL;
+        free(table);
+    }
+
+    return NULL;
+}
+
+st_entry* st_find(s_table* table, const void* pos){
+
+    if(table == NULL || pos == NULL)
+        return NULL;
+
+    st_entry* entry = &table->slots[st_probe(table,pos)];
+    return entry->pos != NULL ? entry : NULL;
+}
+
+st_entry* st_insert(s_table* table, const void* pos){
+
+    if(table == NULL || pos == NULL)
+        return NULL;
+
+    uint32_t i = st_probe(table,pos);
+
+    if(table->slots[i].pos != NULL)
+        return &table->slots[i];
+
+    // keep the table at most three quarters full, so that probe sequences stay short.
+    if((table->count + 1) * 4 > table->capacity * 3){
+        if(!st_grow(table))
+            return NULL;
+        i = st_probe(table,pos);
+    }
+
+    table->slots[i].pos = pos;
+    table->slots[i].handle = H_NULL;
+    table->slots[i].rank_id = R_NIL;
+    ++table->count;
+    return &table->slots[i];
+}
+
+bool st_remove(s_table* table, const void* pos){
+
+    if(table == NULL || pos == NULL)
+        return false;
+
+    uint32_t mask = table->capacity - 1;
+    uint32_t hole = st_probe(table,pos);
+
+    if(table->slots[hole].pos == NULL)
+        return false;
+
+    // shift back every following entry of the run whose home does not lie between the hole
+    // and the entry, so that no probe sequence is broken by the hole.
+    for(uint32_t i = (hole + 1) & mask; table->slots[i].pos != NULL; i = (i + 1) & mask){
+
+        uint32_t home = st_home(table,table->slots[i].pos);
+
+        if(((i - home) & mask) >= ((i - hole) & mask)){
+            table->slots[hole] = table->slots[i];
+            hole = i;
+        }
+    }
+
+    table->slots[hole].pos = NULL;
+    --table->count;
+    return true;
+}
+
+void st_relocate(s_table* table, const void* old_pos, const void* new_pos){
+
+    st_entry* entry = st_find(table,old_pos);
+
+    if(entry == NULL || new_pos == NULL)
+        return;
+
+    st_entry moved = *entry;
+    moved.pos = new_pos;
+    st_remove(table,old_pos);
+
+    // the removal left room for the entry, so the table does not grow.
+    table->slots[st_probe(table,new_pos)] = moved;
+    ++table->count;
+}
+
+size_t st_bytes(s_table* table){
+    return table != NULL ? sizeof(s_table) + (size_t) table->capacity * sizeof(st_entry) : 0;
+}
@@ -0,0 +1,268 @@
+/**
+ * @brief This skip_list.c file contains the implementations of the functions that access and
+ * manipulate the "s_list" and "sl_pos" structs.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/skip_list.h"
+
+////////////////////// POSITION HELPERS //////////////////////
+
+/**
+ * @brief Allocates a position with room for "height" forward links.
+ */
+static sl_pos* new_sl_pos(void* elem_ptr, uint height){
+
+    sl_pos* pos = malloc(sizeof(sl_pos) + height * sizeof(sl_pos*));
+
+    if(pos != NULL){
+        pos->data_ptr = elem_ptr;
+        pos->prev_ptr = NULL;
+        pos->height = height;
+        for(uint i=0; i<height; ++i)
+            pos->next_ptr[i] = NULL;
+    }
+
+    return pos;
+}
+
+/**
+ * @brief Draws the height of a new position: 1 plus one more level with probability 1/4
+ * for every level, using a xorshift generator.
+ */
+static uint random_height(s_list* list){
+
+    uint64_t x = list->rng;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    list->rng = x;
+
+    // every pair of random bits that are both zero adds a level.
+    uint height = 1;
+    while(height < SL_MAX_LEVEL && (x & 3) == 0){
+        ++height;
+        x >>= 2;
+    }
+
+    return height;
+}
+
+/**
+ * @brief Finds, on every level, the last position before the place where a key belongs.
+ * With "after_equal" the place is after the elements equal to the key, otherwise before them.
+ */
+static void find_predecessors(void* key, s_list* list, BOOL after_equal, sl_pos** update){
+
+    sl_pos* pos = list->header;
+
+    for(int i = list->level - 1; i >= 0; --i){
+
+        sl_pos* next = pos->next_ptr[i];
+
+        while(next != NULL){
+            int order = list->compare(next->data_ptr,key);
+            if(order > 0 || (order == 0 && after_equal == FALSE))
+                break;
+            pos = next;
+            next = pos->next_ptr[i];
+        }
+
+        update[i] = pos;
+    }
+}
+
+////////////////////// END OF POSITION HELPERS //////////////////////
+
+
+////////////////////// SKIP LIST FUNCTIONS //////////////////////
+
+s_list* init_s_list(sl_compare compare){
+
+    if(compare == NULL)
+        return NULL;
+
+    s_list* list = malloc(sizeof(s_list));
+
+    if(list == NULL)
+        return NULL;
+
+    list->header = new_sl_pos(NULL,SL_MAX_LEVEL);
+
+    if(list->header == NULL){
+        free(list);
+        return NULL;
+    }
+
+    list->tail = NULL;
+    list->level = 1;
+    list->num_elements = 0;
+    list->compare = compare;
+    list->rng = 0x9e3779b97f4a7c15ULL ^ (uint64_t)(uintptr_t) list;
+
+    return list;
+}
+
+s_list* destroy_s_list(s_list* list){
+
+    if(list != NULL){
+
+        sl_pos* pos = list->header;
+
+        while(pos != NULL){
+            sl_pos* next = pos->next_ptr[0];
+            free(pos);
+            pos = next;
+        }
+
+        free(list);
+    }
+
+    return NULL;
+}
+
+uint sl_size(s_list* list){
+    return (list != NULL) ? list->num_elements : 0;
+}
+
+BOOL sl_is_empty(s_list* list){
+    return (list != NULL && list->num_elements > 0) ? FALSE : TRUE;
+}
+
+void* sl_get_element(sl_pos* pos){
+    return (pos != NULL) ? pos->data_ptr : NULL;
+}
+
+sl_pos* sl_first(s_list* list){
+    return (list != NULL) ? list->header->next_ptr[0] : NULL;
+}
+
+sl_pos* sl_last(s_list* list){
+    return (list != NULL) ? list->tail : NULL;
+}
+
+sl_pos* sl_after(sl_pos* pos){
+    return (pos != NULL) ? pos->next_ptr[0] : NULL;
+}
+
+sl_pos* sl_before(sl_pos* pos){
+    return (pos != NULL) ? pos->prev_ptr : NULL;
+}
+
+sl_pos* sl_insert(void* elem_ptr, s_list* list){
+
+    if(elem_ptr == NULL || list == NULL)
+        return NULL;
+
+    sl_pos* update[SL_MAX_LEVEL];
+    find_predecessors(elem_ptr,list,TRUE,update);
+
+    uint height = random_height(list);
+    sl_pos* pos = new_sl_pos(elem_ptr,height);
+
+    if(pos == NULL)
+        return NULL;
+
+    // new levels start at the header.
+    for(uint i = list->level; i < height; ++i)
+        update[i] = list->header;
+    if(height > list->level)
+        list->level = height;
+
+    for(uint i=0; i<height; ++i){
+        pos->next_ptr[i] = update[i]->next_ptr[i];
+        update[i]->next_ptr[i] = pos;
+    }
+
+    pos->prev_ptr = update[0] != list->header ? update[0] : NULL;
+
+    if(pos->next_ptr[0] != NULL)
+        pos->next_ptr[0]->prev_ptr = pos;
+    else
+        list->tail = pos;
+
+    ++(list->num_elements);
+    return pos;
+}
+
+sl_pos* sl_lower_bound(void* key, s_list* list){
+
+    if(key == NULL || list == NULL)
+        return NULL;
+
+    sl_pos* update[SL_MAX_LEVEL];
+    find_predecessors(key,list,FALSE,update);
+    return update[0]->next_ptr[0];
+}
+
+sl_pos* sl_upper_bound(void* key, s_list* list){
+
+    if(key == NULL || list == NULL)
+        return NULL;
+
+    sl_pos* update[SL_MAX_LEVEL];
+    find_predecessors(key,list,TRUE,update);
+    return update[0]->next_ptr[0];
+}
+
+sl_pos* sl_find(void* key, s_list* list){
+
+    sl_pos* pos = sl_lower_bound(key,list);
+
+    return (pos != NULL && list->compare(pos->data_ptr,key) == 0) ? pos : NULL;
+}
+
+void* sl_delete(sl_pos* pos, s_list* list){
+
+    if(pos == NULL || list == NULL)
+        return NULL;
+
+    sl_pos* update[SL_MAX_LEVEL];
+    find_predecessors(pos->data_ptr,list,FALSE,update);
+
+    // elements equal to this one may precede it; step over them on each of its levels.
+    for(uint i=0; i<pos->height; ++i){
+        while(update[i]->next_ptr[i] != pos){
+            if(update[i]->next_ptr[i] == NULL)
+                return NULL;
+            update[i] = update[i]->next_ptr[i];
+        }
+    }
+
+    for(uint i=0; i<pos->height; ++i)
+        update[i]->next_ptr[i] = pos->next_ptr[i];
+
+    if(pos->next_ptr[0] != NULL)
+        pos->next_ptr[0]->prev_ptr = pos->prev_ptr;
+    else
+        list->tail = pos->prev_ptr;
+
+    while(list->level > 1 && list->header->next_ptr[list->level - 1] == NULL)
+        --(list->level);
+
+    void* elem_ptr = pos->data_ptr;
+    free(pos);
+    --(list->num_elements);
+    return elem_ptr;
+}
+
+uint sl_for_range(s_list* list, void* low, void* high, ptr_visit func, void* ctx){
+
+    if(list == NULL || func == NULL)
+        return 0;
+
+    uint count = 0;
+    sl_pos* pos = low != NULL ? sl_lower_bound(low,list) : sl_first(list);
+
+    while(pos != NULL && (high == NULL || list->compare(pos->data_ptr,high) < 0)){
+        func(pos->data_ptr,ctx);
+        pos = pos->next_ptr[0];
+        ++count;
+    }
+
+    return count;
+}
+
+////////////////////// END OF SKIP LIST FUNCTIONS //////////////////////
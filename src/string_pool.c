@@ -0,0 +1,246 @@
+/**
+ * @brief This string_pool.c file contains the implementations of the functions that access
+ * and manipulate the "str_pool" struct and the strings interned in it.
+ *
+ * @author Pheello James Mokoena
+ * @date 18 October 2026
+ */
+
+#include "../include/string_pool.h"
+#include "../include/fnv_hash.h"
+#include <string.h>
+
+////////////////////// POOL HELPERS //////////////////////
+
+/**
+ * @brief Hashes "length" characters, as "gt_str_hash" does for a null terminated string.
+ */
+static inline size_t hash_chars(const char* str, uint32_t length){
+    return (size_t) fnv_hash(FNV_OFFSET_BASIS,str,length);
+}
+
+/**
+ * @brief Spreads the bits of a hash code over the slot index, since FNV-1a varies little in
+ * its low bits for short strings that differ in their last character.
+ */
+static inline size_t slot_of(size_t hash, uint capacity){
+    uint64_t x = (uint64_t) hash * 0x9e3779b97f4a7c15ULL;
+    return (size_t) (x >> 32) & (capacity - 1);
+}
+
+/**
+ * @brief Finds the slot of a string, or the empty slot where it belongs.
+ */
+static sp_slot* find_slot(str_pool* pool, const char* str, uint32_t length, size_t hash){
+
+    for(size_t i = slot_of(hash,pool->capacity); ; i = (i + 1) & (pool->capacity - 1)){
+
+        sp_slot* slot = &pool->slots[i];
+
+        if(slot->str == NULL)
+            return slot;
+
+        if(slot->hash == hash && sp_length(slot->str) == length && memcmp(slot->str,str,length) == 0)
+            return slot;
+    }
+}
+
+/**
+ * @brief Doubles the table and reinserts the strings by their stored hash codes.
+ */
+static bool grow_table(str_pool* pool){
+
+    uint capacity = pool->capacity * 2;
+    sp_slot* slots = calloc(capacity,sizeof(sp_slot));
+
+    if(slots == NULL)
+        return false;
+
+    for(uint i=0; i<pool->capacity; ++i){
+
+        if(pool->slots[i].str == NULL)
+            continue;
+
+        size_t j = slot_of(pool->slots[i].hash,capacity);
+        while(slots[j].str != NULL)
+            j = (j + 1) & (capacity - 1);
+        slots[j] = pool->slots[i];
+    }
+
+    free(pool->slots);
+    pool->slots = slots;
+    pool->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Stores a string with its header in the current block, starting a new block when
+ * it does not fit. Headers are kept aligned to the size of a pointer.
+ */
+static string store_string(str_pool* pool, const char* str, uint32_t length, size_t hash){
+
+    size_t align = sizeof(void*);
+    size_t need = (sizeof(sp_header) + length + 1 + align - 1) & ~(align - 1);
+
+    if(pool->block == NULL || pool->block_used + need > pool->block_size){
+
+        // strings too long for a normal block get a block of their own.
+        size_t size = sizeof(char*) + need > SP_BLOCK_SIZE ? sizeof(char*) + need : SP_BLOCK_SIZE;
+        char* block = malloc(size);
+
+        if(block == NULL)
+            return NULL;
+
+        *(char**) block = pool->block;
+        pool->block = block;
+        pool->block_used = sizeof(char*);
+        pool->block_size = size;
+        pool->block_bytes += size;
+    }
+
+    sp_header* header = (sp_header*) (pool->block + pool->block_used);
+    header->hash = hash;
+    header->length = length;
+
+    string copy = (string) (header + 1);
+    memcpy(copy,str,length);
+    copy[length] = '\0';
+
+    pool->block_used += need;
+    return copy;
+}
+
+////////////////////// END OF POOL HELPERS //////////////////////
+
+
+////////////////////// STRING POOL FUNCTIONS //////////////////////
+
+str_pool* init_str_pool(){
+
+    str_pool* pool = malloc(sizeof(str_pool));
+
+    if(pool == NULL)
+        return NULL;
+
+    pool->slots = calloc(SP_DEFAULT_CAPACITY,sizeof(sp_slot));
+
+    if(pool->slots == NULL){
+        free(pool);
+        return NULL;
+    }
+
+    pool->capacity = SP_DEFAULT_CAPACITY;
+    pool->num_strings = 0;
+    pool->block = NULL;
+    pool->block_used = 0;
+    pool->block_size = 0;
+    pool->block_bytes = 0;
+    pool->num_requests = 0;
+
+    return pool;
+}
+
+str_pool* destroy_str_pool(str_pool* pool){
+
+    if(pool != NULL){
+
+        while(pool->block != NULL){
+            char* prev = *(char**) pool->block;
+            free(pool->block);
+            pool->block = prev;
+        }
+
+        free(pool->slots);
+        free(pool);
+    }
+
+    return NULL;
+}
+
+uint sp_size(str_pool* pool){
+    return (pool != NULL) ? pool->num_strings : 0;
+}
+
+string sp_intern_n(str_pool* pool, const char* str, uint32_t length){
+
+    if(pool == NULL || str == NULL)
+        return NULL;
+
+    ++(pool->num_requests);
+
+    size_t hash = hash_chars(str,length);
+    sp_slot* slot = find_slot(pool,str,length,hash);
+
+    if(slot->str != NULL)
+        return slot->str;
+
+    // keep the table at most three quarters full.
+    if(4 * (pool->num_strings + 1) > 3 * pool->capacity){
+        if(!grow_table(pool))
+            return NULL;
+        slot = find_slot(pool,str,length,hash);
+    }
+
+    string copy = store_string(pool,str,length,hash);
+
+    if(copy == NULL)
+        return NULL;
+
+    slot->hash = hash;
+    slot->str = copy;
+    ++(pool->num_strings);
+    return copy;
+}
+
+string sp_intern(str_pool* pool, const char* str){
+    return (str != NULL) ? sp_intern_n(pool,str,(uint32_t) strlen(str)) : NULL;
+}
+
+string sp_lookup(str_pool* pool, const char* str){
+
+    if(pool == NULL || str == NULL)
+        return NULL;
+
+    uint32_t length = (uint32_t) strlen(str);
+    return find_slot(pool,str,length,hash_chars(str,length))->str;
+}
+
+bool sp_equals(const char* str_a, const char* str_b){
+
+    if(str_a == str_b)
+        return true;
+
+    if(str_a == NULL || str_b == NULL)
+        return false;
+
+    return sp_hash(str_a) == sp_hash(str_b) && sp_length(str_a) == sp_length(str_b) && memcmp(str_a,str_b,sp_length(str_a)) == 0;
+}
+
+size_t sp_key_hash(void* data){
+    return sp_hash(data);
+}
+
+bool sp_key_equals(void* data_a, void* data_b){
+    return sp_equals(data_a,data_b);
+}
+
+pl_pos* sp_search(const char* elem_ptr, p_list* list){
+
+    if(elem_ptr == NULL || list == NULL)
+        return NULL;
+
+    uint32_t length = (uint32_t) strlen(elem_ptr);
+    size_t hash = hash_chars(elem_ptr,length);
+
+    for(pl_cursor cur = pl_cursor_begin(list); pl_cursor_valid(&cur) == TRUE; pl_cursor_next(&cur)){
+
+        const char* elem = pl_cursor_get(&cur);
+
+        if(elem == elem_ptr || (sp_hash(elem) == hash && sp_length(elem) == length && memcmp(elem,elem_ptr,length) == 0))
+            return pl_cursor_pos(&cur);
+    }
+
+    return NULL;
+}
+
+////////////////////// END OF STRING POOL FUNCTIONS //////////////////////